@@ -13,6 +13,7 @@
 #include "Settings.h"
 #include "Results.h"
 #include "Iteration.h"
+#include "PointStore.h"
 #include "Utilities.h"
 #include "Timing.h"
 #include "Problem.h"
@@ -113,7 +114,12 @@ void DualSolver::addHyperplane(Hyperplane& hyperplane)
 {
     assert((int)hyperplane.generatedPoint.size() == env->reformulatedProblem->properties.numberOfVariables);
 
-    hyperplane.pointHash = Utilities::calculateHash(hyperplane.generatedPoint);
+    hyperplane.pointHash = Utilities::calculateHash(hyperplane.generatedPoint.get());
+
+    // Hyperplanes generated in the same point share one copy of it
+    hyperplane.generatedPoint = env->pointStore->add(hyperplane.generatedPoint);
+
+    std::lock_guard<std::recursive_mutex> lock(cutGenerationMutex);
 
     if(((hyperplane.source == E_HyperplaneSource::ObjectiveRootsearch
             || hyperplane.source == E_HyperplaneSource::ObjectiveCuttingPlane)
@@ -133,6 +139,8 @@ void DualSolver::addHyperplane(Hyperplane& hyperplane)
 
 void DualSolver::addGeneratedHyperplane(const Hyperplane& hyperplane)
 {
+    std::lock_guard<std::recursive_mutex> lock(cutGenerationMutex);
+
     std::string source = "";
 
     switch(hyperplane.source)
@@ -173,6 +181,9 @@ void DualSolver::addGeneratedHyperplane(const Hyperplane& hyperplane)
     case E_HyperplaneSource::ObjectiveCuttingPlane:
         source = "objective cutting plane";
         break;
+    case E_HyperplaneSource::McCormickRelaxation:
+        source = "McCormick relaxation";
+        break;
     default:
         break;
     }
@@ -236,6 +247,8 @@ bool DualSolver::hasHyperplaneBeenAdded(double hash, int constraintIndex)
     if(env->settings->getSetting<int>("TreeStrategy", "Dual") == static_cast<int>(ES_TreeStrategy::SingleTree))
         return false;
 
+    std::lock_guard<std::recursive_mutex> lock(cutGenerationMutex);
+
     for(auto& H : generatedHyperplanes)
     {
         if((H.source == E_HyperplaneSource::ObjectiveRootsearch
@@ -266,6 +279,10 @@ void DualSolver::addIntegerCut(IntegerCut integerCut)
 
     integerCut.pointHash = Utilities::calculateHash(integerCut.variableValues);
 
+    // Cuts over different subsets of the discrete variables can have the same values
+    if((int)integerCut.variableIndexes.size() < env->reformulatedProblem->properties.numberOfDiscreteVariables)
+        integerCut.pointHash += Utilities::calculateHash(integerCut.variableIndexes);
+
     if(!hasIntegerCutBeenAdded(integerCut.pointHash))
         this->integerCutWaitingList.push_back(integerCut);
     else
@@ -308,6 +325,12 @@ void DualSolver::addGeneratedIntegerCut(IntegerCut integerCut)
     env->output->outputDebug("        Integer cut generated from: " + source);
 }
 
+std::vector<std::shared_ptr<InteriorPoint>> DualSolver::getInteriorPoints()
+{
+    std::lock_guard<std::recursive_mutex> lock(cutGenerationMutex);
+    return (interiorPts);
+}
+
 bool DualSolver::hasIntegerCutBeenAdded(double hash)
 {
     for(auto& IC : generatedIntegerCuts)
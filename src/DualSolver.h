@@ -12,6 +12,8 @@
 #include "Environment.h"
 #include "Structs.h"
 
+#include <mutex>
+
 namespace SHOT
 {
 class DualSolver
@@ -44,8 +46,18 @@ public:
     std::vector<std::shared_ptr<InteriorPoint>> interiorPointCandidates;
     std::vector<std::shared_ptr<InteriorPoint>> interiorPts;
 
+    // Returns a copy of the current interior points that remains valid if the points are updated by another thread
+    std::vector<std::shared_ptr<InteriorPoint>> getInteriorPoints();
+
+    // Guards the hyperplane containers and the interior points when cuts are generated from several threads, e.g., in
+    // the MIP solver callbacks
+    std::recursive_mutex cutGenerationMutex;
+
     double cutOffToUse;
     bool useCutOff = false;
+
+    // Time limit (s) for solving the next MIP problem, the remaining total time is used if this is larger
+    double iterationTimeLimit = SHOT_DBL_MAX;
     bool isSingleTree = false;
 
 private:
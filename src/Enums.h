@@ -70,7 +70,8 @@ enum class E_HyperplaneSource
     InteriorPointSearch,
     MIPCallbackRelaxed,
     ObjectiveRootsearch,
-    ObjectiveCuttingPlane
+    ObjectiveCuttingPlane,
+    McCormickRelaxation
 };
 
 enum class E_IntegerCutSource
@@ -152,7 +153,8 @@ enum class E_PrimalSolutionSource
     MIPSolutionPool,
     LPFixedIntegers,
     MIPCallback,
-    InteriorPointSearch
+    InteriorPointSearch,
+    RoundingAndRepair
 };
 
 enum class E_ProblemConvexity
@@ -311,7 +313,9 @@ enum class ES_RootsearchConstraintStrategy
 enum class ES_RootsearchMethod
 {
     BoostTOMS748,
-    BoostBisection
+    BoostBisection,
+    SafeguardedNewton,
+    KarySection
 };
 
 enum class ES_MIPSolver
@@ -329,6 +333,14 @@ enum class ES_MIPPresolveStrategy
     EveryIteration
 };
 
+enum class ES_MIPSolutionLimitStrategy
+{
+    Increase,
+    Adaptive,
+    Unlimited,
+    GapAndTimeBudget
+};
+
 enum class ES_OutputDirectory
 {
     Problem,
@@ -37,6 +37,8 @@ public:
     TaskHandlerPtr tasks;
     TimingPtr timing;
     EventHandlerPtr events;
+    PointStorePtr pointStore;
+    ThreadPoolPtr threadPool;
 
     std::shared_ptr<IRootsearchMethod> rootsearchMethod;
 
@@ -12,6 +12,8 @@
 #include "Results.h"
 #include "Settings.h"
 
+#include "Model/Problem.h"
+
 namespace SHOT
 {
 
@@ -50,6 +52,22 @@ Iteration::~Iteration()
 
 bool Iteration::isMIP() { return (this->isDualProblemDiscrete); }
 
+PairIndexValue Iteration::getSolutionPointDeviation(size_t index)
+{
+    auto& solutionPoint = solutionPoints.at(index);
+
+    if(!solutionPoint.isMaxDeviationCalculated)
+    {
+        auto maxDev = env->reformulatedProblem->getMaxNumericConstraintValue(
+            solutionPoint.point, env->reformulatedProblem->nonredundantNonlinearConstraints);
+
+        solutionPoint.maxDeviation = PairIndexValue(maxDev.constraint->index, maxDev.normalizedValue);
+        solutionPoint.isMaxDeviationCalculated = true;
+    }
+
+    return (solutionPoint.maxDeviation);
+}
+
 SolutionPoint Iteration::getSolutionPointWithSmallestDeviation()
 {
     double tmpVal = SHOT_DBL_MIN;
@@ -57,10 +75,12 @@ SolutionPoint Iteration::getSolutionPointWithSmallestDeviation()
 
     for(size_t i = 0; i < solutionPoints.size(); i++)
     {
-        if(solutionPoints.at(i).maxDeviation.value > tmpVal)
+        double deviation = getSolutionPointDeviation(i).value;
+
+        if(deviation > tmpVal)
         {
             tmpIdx = i;
-            tmpVal = solutionPoints.at(i).maxDeviation.value;
+            tmpVal = deviation;
         }
     }
 
@@ -74,10 +94,12 @@ int Iteration::getSolutionPointWithSmallestDeviationIndex()
 
     for(size_t i = 0; i < solutionPoints.size(); i++)
     {
-        if(solutionPoints.at(i).maxDeviation.value > tmpVal)
+        double deviation = getSolutionPointDeviation(i).value;
+
+        if(deviation > tmpVal)
         {
             tmpIdx = i;
-            tmpVal = solutionPoints.at(i).maxDeviation.value;
+            tmpVal = deviation;
         }
     }
 
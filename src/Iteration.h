@@ -38,6 +38,7 @@ public:
     double usedConstraintTolerance;
 
     int usedMIPSolutionLimit;
+    double usedMIPRelativeGap = 0.0;
     bool MIPSolutionLimitUpdated;
 
     int iterationNumber;
@@ -63,6 +64,9 @@ public:
 
     std::vector<VectorDouble> hyperplanePoints;
 
+    // Returns the maximal nonlinear constraint deviation of the solution point, calculating it if not already done
+    PairIndexValue getSolutionPointDeviation(size_t index);
+
     SolutionPoint getSolutionPointWithSmallestDeviation();
     int getSolutionPointWithSmallestDeviationIndex();
 
@@ -24,6 +24,9 @@ public:
 
     virtual int getInitialLimit() = 0;
 
+    // Updates the other termination criteria, e.g., relative gap and time limit, for the next MIP problem
+    virtual void updateIterationLimits() {}
+
     EnvironmentPtr env;
 
 protected:
@@ -87,6 +87,10 @@ public:
 
     virtual void setTimeLimit(double seconds) = 0;
 
+    // Sets the relative objective gap used as termination criterion when solving the next MIP problem
+    virtual void setRelativeGap(double gap) = 0;
+    virtual double getRelativeGap() = 0;
+
     virtual void setCutOff(double cutOff) = 0;
     virtual void setCutOffAsConstraint(double cutOff) = 0;
 
@@ -112,6 +116,9 @@ public:
 
     virtual std::optional<std::pair<std::map<int, double>, double>> createHyperplaneTerms(Hyperplane hyperplane) = 0;
 
+    // Cleans up and rescales the terms of a hyperplane cut, returns false if the cut should not be added
+    virtual bool postProcessHyperplaneTerms(std::map<int, double>& elements, double& constant) = 0;
+
     virtual bool supportsQuadraticObjective() = 0;
     virtual bool supportsQuadraticConstraints() = 0;
 
@@ -0,0 +1,97 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "MIPSolutionLimitStrategyGapAndTimeBudget.h"
+#include "../DualSolver.h"
+#include "../Iteration.h"
+#include "../Output.h"
+#include "../Results.h"
+#include "../Settings.h"
+#include "../MIPSolver/IMIPSolver.h"
+
+namespace SHOT
+{
+
+MIPSolutionLimitStrategyGapAndTimeBudget::MIPSolutionLimitStrategyGapAndTimeBudget(EnvironmentPtr envPtr)
+{
+    env = envPtr;
+
+    relativeGap = std::max(env->settings->getSetting<double>("MIP.SolutionLimit.Budget.InitialRelativeGap", "Dual"),
+        env->settings->getSetting<double>("ObjectiveGap.Relative", "Termination"));
+    timeLimit = env->settings->getSetting<double>("MIP.SolutionLimit.Budget.InitialTimeLimit", "Dual");
+}
+
+bool MIPSolutionLimitStrategyGapAndTimeBudget::updateLimit() { return (false); }
+
+int MIPSolutionLimitStrategyGapAndTimeBudget::getNewLimit() { return (getInitialLimit()); }
+
+int MIPSolutionLimitStrategyGapAndTimeBudget::getInitialLimit() { return (2100000000); }
+
+void MIPSolutionLimitStrategyGapAndTimeBudget::updateIterationLimits()
+{
+    auto currIter = env->results->getCurrentIteration();
+    auto prevIter = env->results->getPreviousIteration();
+
+    double terminationGap = env->settings->getSetting<double>("ObjectiveGap.Relative", "Termination");
+
+    if(relativeGap > terminationGap && prevIter->isMIP())
+    {
+        double tighteningFactor
+            = env->settings->getSetting<double>("MIP.SolutionLimit.Budget.TighteningFactor", "Dual");
+
+        double previousDualBound = prevIter->currentObjectiveBounds.first;
+        double currentDualBound = currIter->currentObjectiveBounds.first;
+
+        bool isDualBoundUpdated = (currentDualBound != previousDualBound);
+
+        // The gap limits the progress if the dual bound improved less than the MIP solver was allowed to leave open
+        bool isStagnated = !isDualBoundUpdated
+            || std::abs(currentDualBound - previousDualBound) / std::max(1.0, std::abs(currentDualBound))
+                < relativeGap;
+
+        // If the MIP solution fulfills the nonlinear constraints, only a more exact MIP solution can close the gap
+        bool isMature = prevIter->solutionPoints.size() > 0
+            && prevIter->maxDeviation <= env->settings->getSetting<double>("ConstraintTolerance", "Termination");
+
+        if(prevIter->solutionStatus == E_ProblemSolutionStatus::TimeLimit && !isDualBoundUpdated)
+        {
+            // The time limit was too short for the MIP solver to make any progress
+            timeLimit *= 2.0;
+        }
+        else if(isStagnated || isMature)
+        {
+            double newRelativeGap = std::max(terminationGap, tighteningFactor * relativeGap);
+
+            // A tighter gap requires more time
+            timeLimit *= relativeGap / newRelativeGap;
+            relativeGap = newRelativeGap;
+        }
+
+        // No need to solve the MIP problem to a larger gap than what remains globally
+        double globalRelativeGap = env->results->getRelativeGlobalObjectiveGap();
+
+        if(globalRelativeGap < relativeGap)
+            relativeGap = std::max(terminationGap, tighteningFactor * globalRelativeGap);
+    }
+
+    if(relativeGap <= terminationGap)
+    {
+        // The final iterations are solved to the termination gap without an iteration time limit
+        relativeGap = terminationGap;
+        timeLimit = SHOT_DBL_MAX;
+    }
+
+    env->dualSolver->MIPSolver->setRelativeGap(relativeGap);
+    env->dualSolver->iterationTimeLimit = timeLimit;
+
+    env->output->outputDebug(
+        fmt::format("        MIP relative gap set to {} and iteration time limit to {} s.", relativeGap, timeLimit));
+}
+} // namespace SHOT
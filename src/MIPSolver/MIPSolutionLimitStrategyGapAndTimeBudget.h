@@ -0,0 +1,35 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+
+#include "IMIPSolutionLimitStrategy.h"
+#include "Environment.h"
+
+namespace SHOT
+{
+// Solves the MIP problems without a solution limit, but to a relative gap and within a time limit based on the
+// progress of the dual bound. The gap is tightened towards the termination gap as the outer approximation matures.
+class MIPSolutionLimitStrategyGapAndTimeBudget : public IMIPSolutionLimitStrategy
+{
+public:
+    MIPSolutionLimitStrategyGapAndTimeBudget(EnvironmentPtr envPtr);
+    ~MIPSolutionLimitStrategyGapAndTimeBudget() override = default;
+
+    bool updateLimit() override;
+    int getNewLimit() override;
+    int getInitialLimit() override;
+
+    void updateIterationLimits() override;
+
+    double relativeGap;
+    double timeLimit;
+};
+} // namespace SHOT
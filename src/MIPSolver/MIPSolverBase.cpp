@@ -17,6 +17,8 @@
 #include "../Settings.h"
 #include "../Utilities.h"
 
+#include <unordered_set>
+
 namespace SHOT
 {
 
@@ -74,7 +76,10 @@ std::vector<SolutionPoint> MIPSolverBase::getAllVariableSolutions()
 
     int numSol = getNumberOfSolutions();
 
-    std::vector<SolutionPoint> lastSolutions(numSol);
+    lastSolutions.clear();
+    lastSolutions.reserve(numSol);
+
+    std::unordered_set<double> addedHashes;
 
     for(int i = 0; i < numSol; i++)
     {
@@ -82,29 +87,31 @@ std::vector<SolutionPoint> MIPSolverBase::getAllVariableSolutions()
 
         auto tmpPt = getVariableSolution(i);
 
-        while((int)tmpPt.size() > env->reformulatedProblem->properties.numberOfVariables)
-        {
-            tmpPt.pop_back();
-        }
+        if((int)tmpPt.size() > env->reformulatedProblem->properties.numberOfVariables)
+            tmpPt.resize(env->reformulatedProblem->properties.numberOfVariables);
 
-        tmpSolPt.point = tmpPt;
         tmpSolPt.hashValue = Utilities::calculateHash(tmpPt);
 
+        // The solution pool may contain duplicates, only the first (and best) one is kept
+        if(!addedHashes.insert(tmpSolPt.hashValue).second)
+            continue;
+
+        tmpSolPt.point = std::move(tmpPt);
         tmpSolPt.objectiveValue = getObjectiveValue(i);
         tmpSolPt.iterFound = env->results->getCurrentIteration()->iterationNumber;
 
+        // The deviation is calculated only when needed, see Iteration::getSolutionPointDeviation
         if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
         {
-            auto maxDev = env->reformulatedProblem->getMaxNumericConstraintValue(
-                tmpPt, env->reformulatedProblem->nonlinearConstraints);
-            tmpSolPt.maxDeviation = PairIndexValue(maxDev.constraint->index, maxDev.normalizedValue);
+            tmpSolPt.maxDeviation = PairIndexValue(-1, SHOT_DBL_MAX);
+            tmpSolPt.isMaxDeviationCalculated = false;
         }
         else
         {
             tmpSolPt.maxDeviation = PairIndexValue(-1, 0.0);
         }
 
-        lastSolutions.at(i) = tmpSolPt;
+        lastSolutions.push_back(tmpSolPt);
     }
 
     cachedSolutionHasChanged = false;
@@ -144,35 +151,21 @@ bool MIPSolverBase::createHyperplane(Hyperplane hyperplane)
         }
     }
 
-    // Small fix to fix badly scaled cuts.
-    // TODO: this should be made so it also takes into account small/large coefficients of the linear terms
-    if(abs(tmpPair.second) > 1e15)
-    {
-        double scalingFactor = abs(tmpPair.second) - 1e15;
-
-        for(auto& E : tmpPair.first)
-            E.second /= scalingFactor;
-
-        tmpPair.second /= scalingFactor;
-
-        if(!warningMessageShownLargeRHS)
-        {
-            env->output->outputWarning(
-                "        Large values found in RHS of cut, you might want to consider reducing the "
-                "bounds of the nonlinear variables.");
-            warningMessageShownLargeRHS = true;
-        }
-    }
+    if(!postProcessHyperplaneTerms(tmpPair.first, tmpPair.second))
+        return (false);
 
-    std::string constraintName;
+    std::string identifier;
 
-    std::string identifier = getConstraintIdentifier(hyperplane.source);
+    if(env->settings->getSetting<bool>("MIP.UseNames", "Dual"))
+    {
+        identifier = getConstraintIdentifier(hyperplane.source);
 
-    if(hyperplane.sourceConstraint != nullptr)
-        identifier = identifier + "_" + hyperplane.sourceConstraint->name;
+        if(hyperplane.sourceConstraint != nullptr)
+            identifier = identifier + "_" + hyperplane.sourceConstraint->name;
 
-    identifier += "_" + std::to_string(constraintCounter);
-    constraintCounter++;
+        identifier += "_" + std::to_string(constraintCounter);
+        constraintCounter++;
+    }
 
     if(addLinearConstraint(tmpPair.first, tmpPair.second, identifier, false, !hyperplane.isSourceConvex) < 0)
         return (false);
@@ -182,6 +175,9 @@ bool MIPSolverBase::createHyperplane(Hyperplane hyperplane)
 
 std::optional<std::pair<std::map<int, double>, double>> MIPSolverBase::createHyperplaneTerms(Hyperplane hyperplane)
 {
+    if(hyperplane.terms)
+        return (hyperplane.terms);
+
     std::map<int, double> elements;
     double constant = 0.0;
     SparseVariableVector gradient;
@@ -209,6 +205,13 @@ std::optional<std::pair<std::map<int, double>, double>> MIPSolverBase::createHyp
         env->output->outputTrace("        HP point generated for objective function with "
             + std::to_string(gradient.size()) + " elements and constant " + std::to_string(constant));
     }
+    else if(hyperplane.source == E_HyperplaneSource::McCormickRelaxation)
+    {
+        // The linearization of the relaxation is calculated when the cut is selected, and the gradient of the
+        // nonconvex constraint would not give a valid cut
+        env->output->outputError("        McCormick cut without a linearization, the cut is not added.");
+        return (std::nullopt);
+    }
     else
     {
         assert(hyperplane.sourceConstraint);
@@ -280,6 +283,128 @@ std::optional<std::pair<std::map<int, double>, double>> MIPSolverBase::createHyp
     return (optional);
 }
 
+bool MIPSolverBase::postProcessHyperplaneTerms(std::map<int, double>& elements, double& constant)
+{
+    // The cut is on the form sum(a_i*x_i) + constant <= 0
+
+    if(!std::isfinite(constant))
+        return (false);
+
+    double maxCoefficient = 0.0;
+
+    for(auto& E : elements)
+    {
+        if(!std::isfinite(E.second))
+            return (false);
+
+        maxCoefficient = std::max(maxCoefficient, std::abs(E.second));
+    }
+
+    if(maxCoefficient == 0.0)
+    {
+        env->output->outputDebug("        Hyperplane not generated since all coefficients are zero.");
+        return (false);
+    }
+
+    if(!env->settings->getSetting<bool>("HyperplaneCuts.Cleanup.Use", "Dual"))
+        return (true);
+
+    double coefficientTolerance
+        = env->settings->getSetting<double>("HyperplaneCuts.Cleanup.CoefficientTolerance", "Dual");
+    double maxConstantChange = env->settings->getSetting<double>("HyperplaneCuts.Cleanup.MaxConstantChange", "Dual");
+    double maxCoefficientRange
+        = env->settings->getSetting<double>("HyperplaneCuts.Cleanup.MaxCoefficientRange", "Dual");
+
+    // Removes tiny coefficients. The term is replaced with its smallest value over the variable bounds, which is
+    // moved to the constant so that the cut remains valid. The total change of the constant is limited so that the
+    // cut is not weakened too much.
+    double totalConstantChange = 0.0;
+    int numberOfRemovedTerms = 0;
+
+    for(auto E = elements.begin(); E != elements.end();)
+    {
+        int variableIndex = E->first;
+        double coefficient = E->second;
+
+        if(coefficient == 0.0)
+        {
+            E = elements.erase(E);
+            numberOfRemovedTerms++;
+            continue;
+        }
+
+        if(std::abs(coefficient) >= coefficientTolerance * maxCoefficient
+            || (dualAuxiliaryObjectiveVariableDefined && variableIndex == dualAuxiliaryObjectiveVariableIndex)
+            || variableIndex >= (int)variableLowerBounds.size())
+        {
+            E++;
+            continue;
+        }
+
+        double bound = (coefficient > 0) ? variableLowerBounds[variableIndex] : variableUpperBounds[variableIndex];
+        double constantChange = coefficient * bound;
+
+        if(!std::isfinite(constantChange) || totalConstantChange + std::abs(constantChange) > maxConstantChange)
+        {
+            E++;
+            continue;
+        }
+
+        constant += constantChange;
+        totalConstantChange += std::abs(constantChange);
+
+        E = elements.erase(E);
+        numberOfRemovedTerms++;
+    }
+
+    if(numberOfRemovedTerms > 0)
+    {
+        env->output->outputTrace(
+            fmt::format("        Removed {} small coefficients from hyperplane, constant changed {}",
+                numberOfRemovedTerms, totalConstantChange));
+    }
+
+    double minCoefficient = SHOT_DBL_MAX;
+
+    for(auto& E : elements)
+        minCoefficient = std::min(minCoefficient, std::abs(E.second));
+
+    if(maxCoefficient / minCoefficient > maxCoefficientRange)
+    {
+        env->output->outputDebug(
+            fmt::format("        Hyperplane not generated since coefficient range {} is too large.",
+                maxCoefficient / minCoefficient));
+        return (false);
+    }
+
+    // Scales the cut so that the largest coefficient is close to one. A power of two is used as scaling factor so no
+    // rounding errors are introduced.
+    if(maxCoefficient > 1e3 || maxCoefficient < 1e-3)
+    {
+        double scalingFactor = std::ldexp(1.0, -std::ilogb(maxCoefficient));
+
+        for(auto& E : elements)
+            E.second *= scalingFactor;
+
+        constant *= scalingFactor;
+    }
+
+    if(std::abs(constant) > 1e15)
+    {
+        if(!warningMessageShownLargeRHS)
+        {
+            env->output->outputWarning("        Large values found in RHS of cut, you might want to consider reducing "
+                                       "the bounds of the nonlinear variables.");
+            warningMessageShownLargeRHS = true;
+        }
+
+        env->output->outputDebug("        Hyperplane not generated since the RHS is too large.");
+        return (false);
+    }
+
+    return (true);
+}
+
 bool MIPSolverBase::createInteriorHyperplane([[maybe_unused]] Hyperplane hyperplane)
 {
     /*
@@ -63,6 +63,8 @@ public:
 
     std::optional<std::pair<std::map<int, double>, double>> createHyperplaneTerms(Hyperplane hyperplane);
 
+    bool postProcessHyperplaneTerms(std::map<int, double>& elements, double& constant);
+
     virtual void setCutOffAsConstraint(double cutOff) = 0;
 
     virtual E_DualProblemClass getProblemClass();
@@ -162,6 +164,9 @@ public:
         case E_HyperplaneSource::ObjectiveCuttingPlane:
             identifier = "H_CP_OBJ";
             break;
+        case E_HyperplaneSource::McCormickRelaxation:
+            identifier = "H_MC";
+            break;
         default:
             break;
         }
@@ -175,7 +180,7 @@ public:
     int prevSolutionLimit = 1;
 
     bool discreteVariablesActivated;
-    bool cachedSolutionHasChanged;
+    bool cachedSolutionHasChanged = true;
     bool modelUpdated = true;
 
     bool isVariablesFixed = false;
@@ -78,6 +78,7 @@ bool MIPSolverCbc::initializeProblem()
     discreteVariablesActivated = true;
 
     this->cutOff = 1e100;
+    this->relativeGap = env->settings->getSetting<double>("ObjectiveGap.Relative", "Termination");
 
     osiInterface = std::make_unique<OsiClpSolverInterface>();
     coinModel = std::make_unique<CoinModel>();
@@ -106,6 +107,10 @@ bool MIPSolverCbc::addVariable(
     try
     {
         coinModel->setColumnBounds(index, lowerBound, upperBound);
+        // Cbc identifies the variables in MIP starts by name, so a name is always needed
+        if(name.empty())
+            name = "x" + std::to_string(index);
+
         coinModel->setColName(index, name.c_str());
 
         switch(type)
@@ -269,7 +274,8 @@ bool MIPSolverCbc::finalizeConstraint(std::string name, double valueLHS, double
             coinModel->setRowBounds(index, valueRHS - constant, valueLHS - constant);
         }
 
-        coinModel->setRowName(index, name.c_str());
+        if(!name.empty())
+            coinModel->setRowName(index, name.c_str());
     }
     catch(std::exception& e)
     {
@@ -313,7 +319,7 @@ void MIPSolverCbc::initializeSolverSettings()
 {
     // Set termination tolerances
     cbcModel->setAllowableGap(env->settings->getSetting<double>("ObjectiveGap.Absolute", "Termination") / 1.0);
-    cbcModel->setAllowableFractionGap(env->settings->getSetting<double>("ObjectiveGap.Relative", "Termination") / 1.0);
+    cbcModel->setAllowableFractionGap(relativeGap);
     osiInterface->setDblParam(
         OsiPrimalTolerance, env->settings->getSetting<double>("Tolerance.LinearConstraint", "Primal"));
     cbcModel->setIntegerTolerance(env->settings->getSetting<double>("Tolerance.Integer", "Primal"));
@@ -1155,6 +1161,10 @@ void MIPSolverCbc::setTimeLimit(double seconds)
         timeLimit = seconds;
 }
 
+void MIPSolverCbc::setRelativeGap(double gap) { relativeGap = gap; }
+
+double MIPSolverCbc::getRelativeGap() { return (relativeGap); }
+
 void MIPSolverCbc::setCutOff(double cutOff)
 {
     if(cutOff == SHOT_DBL_MAX || cutOff == SHOT_DBL_MIN)
@@ -1295,7 +1305,7 @@ void MIPSolverCbc::deleteMIPStarts() { MIPStart.clear(); }
 
 bool MIPSolverCbc::createIntegerCut(IntegerCut& integerCut)
 {
-    assert(integerCut.variableValues.size() == (size_t)env->reformulatedProblem->properties.numberOfDiscreteVariables);
+    assert(integerCut.variableValues.size() == integerCut.variableIndexes.size());
     bool allowIntegerCutRepair = env->settings->getSetting<bool>("MIP.InfeasibilityRepair.IntegerCuts", "Dual");
 
     int numConstraintsBefore = osiInterface->getNumRows();
@@ -1316,20 +1326,20 @@ bool MIPSolverCbc::createIntegerCut(IntegerCut& integerCut)
         if(integerCut.areAllVariablesBinary) // Integer cut for problem with binary variables only
         {
             size_t index = 0;
+            int numberOfOnes = 0;
             CoinPackedVector cut;
 
-            for(auto& VAR : env->reformulatedProblem->allVariables)
+            for(auto& I : integerCut.variableIndexes)
             {
-                if(!(VAR->properties.type == E_VariableType::Binary || VAR->properties.type == E_VariableType::Integer
-                       || VAR->properties.type == E_VariableType::Semiinteger))
-                    continue;
-
                 int variableValue = integerCut.variableValues[index];
 
                 if(variableValue == 1.0)
-                    cut.insert(VAR->index, 1.0);
+                {
+                    cut.insert(I, 1.0);
+                    numberOfOnes++;
+                }
                 else if(variableValue == 0.0)
-                    cut.insert(VAR->index, -1.0);
+                    cut.insert(I, -1.0);
                 else
                 {
                     env->output->outputDebug("        Integer cut not added by Cbc ");
@@ -1341,7 +1351,7 @@ bool MIPSolverCbc::createIntegerCut(IntegerCut& integerCut)
 
             int tmpNumConstraints = osiInterface->getNumRows();
 
-            osiInterface->addRow(cut, -osiInterface->getInfinity(), integerCut.variableValues.size() - 1.0,
+            osiInterface->addRow(cut, -osiInterface->getInfinity(), numberOfOnes - 1.0,
                 fmt::format("IC_{}", env->solutionStatistics.numberOfIntegerCuts));
 
             if(osiInterface->getNumRows() > tmpNumConstraints)
@@ -106,6 +106,11 @@ public:
         return (MIPSolverBase::createHyperplaneTerms(hyperplane));
     }
 
+    bool postProcessHyperplaneTerms(std::map<int, double>& elements, double& constant) override
+    {
+        return (MIPSolverBase::postProcessHyperplaneTerms(elements, constant));
+    }
+
     void fixVariable(int varIndex, double value) override;
 
     void fixVariables(VectorInteger variableIndexes, VectorDouble variableValues) override
@@ -149,6 +154,9 @@ public:
 
     void setTimeLimit(double seconds) override;
 
+    void setRelativeGap(double gap) override;
+    double getRelativeGap() override;
+
     void setCutOff(double cutOff) override;
     void setCutOffAsConstraint(double cutOff) override;
     void addMIPStart(VectorDouble point) override;
@@ -194,6 +202,7 @@ private:
 
     long int solLimit;
     double timeLimit = 1e100;
+    double relativeGap;
     double cutOff;
     int numberOfThreads = 1;
 
@@ -127,13 +127,16 @@ bool MIPSolverCplex::addVariable(
     if(upperBound > getUnboundedVariableBoundValue())
         upperBound = getUnboundedVariableBoundValue();
 
+    // Cplex uses default names if none are given
+    const char* cplexName = name.empty() ? nullptr : name.c_str();
+
     try
     {
         switch(type)
         {
         case E_VariableType::Real:
         {
-            auto cplexVar = IloNumVar(cplexEnv, lowerBound, upperBound, ILOFLOAT, name.c_str());
+            auto cplexVar = IloNumVar(cplexEnv, lowerBound, upperBound, ILOFLOAT, cplexName);
             cplexVars.add(cplexVar);
             cplexModel.add(cplexVar);
             break;
@@ -142,7 +145,7 @@ bool MIPSolverCplex::addVariable(
         case E_VariableType::Binary:
         {
             isProblemDiscrete = true;
-            auto cplexVar = IloNumVar(cplexEnv, lowerBound, upperBound, ILOINT, name.c_str());
+            auto cplexVar = IloNumVar(cplexEnv, lowerBound, upperBound, ILOINT, cplexName);
             cplexVars.add(cplexVar);
             cplexModel.add(cplexVar);
             break;
@@ -156,7 +159,7 @@ bool MIPSolverCplex::addVariable(
             else
                 lowerBound = semiBound;
             auto cplexVar = IloSemiContVar(cplexEnv, lowerBound, upperBound,
-                (type == E_VariableType::Semicontinuous) ? ILOFLOAT : ILOINT, name.c_str());
+                (type == E_VariableType::Semicontinuous) ? ILOFLOAT : ILOINT, cplexName);
             cplexVars.add(cplexVar);
             cplexModel.add(cplexVar);
             break;
@@ -315,6 +318,8 @@ bool MIPSolverCplex::addQuadraticTermToConstraint(double coefficient, int firstV
 
 bool MIPSolverCplex::finalizeConstraint(std::string name, double valueLHS, double valueRHS, double constant)
 {
+    const char* cplexName = name.empty() ? nullptr : name.c_str();
+
     try
     {
         if(constant != 0.0)
@@ -322,14 +327,14 @@ bool MIPSolverCplex::finalizeConstraint(std::string name, double valueLHS, doubl
 
         if(valueLHS <= valueRHS)
         {
-            IloRange tmpRange = IloRange(cplexEnv, valueLHS, constrExpression, valueRHS, name.c_str());
+            IloRange tmpRange = IloRange(cplexEnv, valueLHS, constrExpression, valueRHS, cplexName);
             cplexModel.add(tmpRange);
             cplexConstrs.add(tmpRange);
             allowRepairOfConstraint.push_back(false);
         }
         else
         {
-            IloRange tmpRange = IloRange(cplexEnv, valueRHS, constrExpression, valueLHS, name.c_str());
+            IloRange tmpRange = IloRange(cplexEnv, valueRHS, constrExpression, valueLHS, cplexName);
             cplexModel.add(tmpRange);
             cplexConstrs.add(tmpRange);
             allowRepairOfConstraint.push_back(false);
@@ -511,7 +516,8 @@ int MIPSolverCplex::addLinearConstraint(
         if(isGreaterThan)
         {
             IloRange tmpRange(cplexEnv, -constant, expr, IloInfinity);
-            tmpRange.setName(name.c_str());
+            if(!name.empty())
+                tmpRange.setName(name.c_str());
 
             cplexModel.add(tmpRange);
             cplexInstance.extract(cplexModel);
@@ -532,7 +538,8 @@ int MIPSolverCplex::addLinearConstraint(
         else
         {
             IloRange tmpRange(cplexEnv, -IloInfinity, expr, -constant);
-            tmpRange.setName(name.c_str());
+            if(!name.empty())
+                tmpRange.setName(name.c_str());
 
             cplexModel.add(tmpRange);
             cplexInstance.extract(cplexModel);
@@ -1157,6 +1164,34 @@ void MIPSolverCplex::setTimeLimit(double seconds)
     }
 }
 
+void MIPSolverCplex::setRelativeGap(double gap)
+{
+    try
+    {
+        cplexInstance.setParam(IloCplex::Param::MIP::Tolerances::MIPGap, gap);
+    }
+    catch(IloException& e)
+    {
+        env->output->outputError("        Error when setting relative gap", e.getMessage());
+    }
+}
+
+double MIPSolverCplex::getRelativeGap()
+{
+    double gap = 0.0;
+
+    try
+    {
+        gap = cplexInstance.getParam(IloCplex::Param::MIP::Tolerances::MIPGap);
+    }
+    catch(IloException& e)
+    {
+        env->output->outputError("        Error when obtaining relative gap", e.getMessage());
+    }
+
+    return (gap);
+}
+
 void MIPSolverCplex::setCutOff(double cutOff)
 {
     try
@@ -21,6 +21,10 @@
 
 #include "../Model/Problem.h"
 
+#include "../RootsearchMethod/RootsearchMethodBoost.h"
+#include "../RootsearchMethod/RootsearchMethodKarySection.h"
+#include "../RootsearchMethod/RootsearchMethodNewton.h"
+
 namespace SHOT
 {
 
@@ -73,11 +77,60 @@ CplexCallback::CplexCallback(EnvironmentPtr envPtr, const IloNumVarArray& vars,
         taskSelectPrimalSolutionFromRootsearch = std::make_shared<TaskSelectPrimalCandidatesFromRootsearch>(env);
     }
 
+    // Creates separate cut generation tasks for each thread Cplex might use
+    int numberOfThreads = std::max((int)cplexInst.getParam(IloCplex::Param::Threads), (int)cplexInst.getNumCores());
+    threadContexts.resize(numberOfThreads);
+
+    auto rootsearchMethodType
+        = static_cast<ES_RootsearchMethod>(env->settings->getSetting<int>("Rootsearch.Method", "Subsolver"));
+
+    for(auto& TC : threadContexts)
+    {
+        std::shared_ptr<IRootsearchMethod> rootsearchMethod;
+
+        if(rootsearchMethodType == ES_RootsearchMethod::SafeguardedNewton)
+            rootsearchMethod = std::make_shared<RootsearchMethodNewton>(env);
+        else if(rootsearchMethodType == ES_RootsearchMethod::KarySection)
+            rootsearchMethod = std::make_shared<RootsearchMethodKarySection>(env);
+        else
+            rootsearchMethod = std::make_shared<RootsearchMethodBoost>(env);
+
+        if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
+        {
+            if(static_cast<ES_HyperplaneCutStrategy>(env->settings->getSetting<int>("CutStrategy", "Dual"))
+                == ES_HyperplaneCutStrategy::ESH)
+            {
+                TC.taskSelectHPPts = std::make_shared<TaskSelectHyperplanePointsESH>(env, rootsearchMethod);
+            }
+            else
+            {
+                TC.taskSelectHPPts = std::make_shared<TaskSelectHyperplanePointsECP>(env);
+            }
+        }
+
+        if(env->reformulatedProblem->objectiveFunction->properties.classification
+            > E_ObjectiveFunctionClassification::Quadratic)
+        {
+            TC.taskSelectHPPtsByObjectiveRootsearch
+                = std::make_shared<TaskSelectHyperplanePointsObjectiveFunction>(env, rootsearchMethod);
+        }
+    }
+
     lastUpdatedPrimal = env->results->getPrimalBound();
 
     isMinimization = env->reformulatedProblem->objectiveFunction->properties.isMinimize;
 }
 
+CplexCallbackThreadContext* CplexCallback::getThreadContext(const IloCplex::Callback::Context& context)
+{
+    int threadId = context.getIntInfo(IloCplex::Callback::Context::Info::ThreadId);
+
+    if(threadId < 0 || threadId >= (int)threadContexts.size())
+        return (nullptr);
+
+    return (&threadContexts[threadId]);
+}
+
 void CplexCallback::invoke(const IloCplex::Callback::Context& context)
 {
     try
@@ -156,15 +209,24 @@ void CplexCallback::invoke(const IloCplex::Callback::Context& context)
             int numberOfAddedHyperplanes;
             int iterationNumber;
 
+            // The iteration is taken while holding the lock, since other threads may create new iterations
+            IterationPtr currIter;
+
             {
                 std::lock_guard<std::mutex> lock(callbackMutex);
-                numberOfAddedHyperplanes = env->results->getCurrentIteration()->relaxedLazyHyperplanesAdded;
-                iterationNumber = env->results->getCurrentIteration()->iterationNumber;
+                currIter = env->results->getCurrentIteration();
+                numberOfAddedHyperplanes = currIter->relaxedLazyHyperplanesAdded;
+                iterationNumber = currIter->iterationNumber;
             }
 
             if(numberOfAddedHyperplanes < env->settings->getSetting<int>("Relaxation.MaxLazyConstraints", "Dual"))
             {
-                int waitingListSize = env->dualSolver->hyperplaneWaitingList.size();
+                int waitingListSize;
+
+                {
+                    std::lock_guard<std::recursive_mutex> waitingListLock(env->dualSolver->cutGenerationMutex);
+                    waitingListSize = env->dualSolver->hyperplaneWaitingList.size();
+                }
 
                 IloNumArray tmpVals(context.getEnv());
 
@@ -188,7 +250,7 @@ void CplexCallback::invoke(const IloCplex::Callback::Context& context)
                 if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
                 {
                     auto maxDev = env->reformulatedProblem->getMaxNumericConstraintValue(
-                        solution, env->reformulatedProblem->nonlinearConstraints);
+                        solution, env->reformulatedProblem->nonredundantNonlinearConstraints);
                     solutionRelaxed.maxDeviation = PairIndexValue(maxDev.constraint->index, maxDev.normalizedValue);
                 }
                 else
@@ -203,28 +265,63 @@ void CplexCallback::invoke(const IloCplex::Callback::Context& context)
 
                 std::vector<SolutionPoint> solutionPoints = { solutionRelaxed };
 
+                // The tasks of the current thread are used, so the callback only needs to be locked if this thread
+                // for some reason has no tasks of its own. The shared hyperplane and primal solution containers are
+                // guarded separately.
+                auto threadContext = getThreadContext(context);
+                std::unique_lock<std::mutex> lock(callbackMutex, std::defer_lock);
+
+                if(threadContext == nullptr)
+                    lock.lock();
+
+                auto currentTaskSelectHPPts = (threadContext) ? threadContext->taskSelectHPPts : taskSelectHPPts;
+
+                if(static_cast<ES_HyperplaneCutStrategy>(env->settings->getSetting<int>("CutStrategy", "Dual"))
+                    == ES_HyperplaneCutStrategy::ESH)
                 {
-                    std::lock_guard<std::mutex> lock(callbackMutex);
-                    if(static_cast<ES_HyperplaneCutStrategy>(env->settings->getSetting<int>("CutStrategy", "Dual"))
-                        == ES_HyperplaneCutStrategy::ESH)
+                    // The interior point task is shared between the threads
+                    if(lock.owns_lock())
                     {
                         tUpdateInteriorPoint->run();
-                        static_cast<TaskSelectHyperplanePointsESH*>(taskSelectHPPts.get())->run(solutionPoints);
                     }
                     else
                     {
-                        static_cast<TaskSelectHyperplanePointsECP*>(taskSelectHPPts.get())->run(solutionPoints);
+                        std::lock_guard<std::mutex> interiorPointLock(callbackMutex);
+                        tUpdateInteriorPoint->run();
                     }
 
-                    if(env->reformulatedProblem->objectiveFunction->properties.classification
-                        > E_ObjectiveFunctionClassification::Quadratic)
-                    {
-                        taskSelectHPPtsByObjectiveRootsearch->run(solutionPoints);
-                    }
+                    static_cast<TaskSelectHyperplanePointsESH*>(currentTaskSelectHPPts.get())
+                        ->run(solutionPoints, currIter);
+                }
+                else
+                {
+                    static_cast<TaskSelectHyperplanePointsECP*>(currentTaskSelectHPPts.get())
+                        ->run(solutionPoints, currIter);
+                }
+
+                if(env->reformulatedProblem->objectiveFunction->properties.classification
+                    > E_ObjectiveFunctionClassification::Quadratic)
+                {
+                    if(threadContext)
+                        threadContext->taskSelectHPPtsByObjectiveRootsearch->run(solutionPoints, currIter);
+                    else
+                        taskSelectHPPtsByObjectiveRootsearch->run(solutionPoints, currIter);
+                }
 
-                    env->results->getCurrentIteration()->relaxedLazyHyperplanesAdded
-                        += (env->dualSolver->hyperplaneWaitingList.size() - waitingListSize);
+                // Other threads may add to, or empty, the waiting list at the same time so the number of added
+                // hyperplanes is only an estimate
+                int numberOfNewHyperplanes;
+
+                {
+                    std::lock_guard<std::recursive_mutex> waitingListLock(env->dualSolver->cutGenerationMutex);
+                    numberOfNewHyperplanes
+                        = std::max(0, (int)env->dualSolver->hyperplaneWaitingList.size() - waitingListSize);
                 }
+
+                if(!lock.owns_lock())
+                    lock.lock();
+
+                currIter->relaxedLazyHyperplanesAdded += numberOfNewHyperplanes;
             }
         }
 
@@ -271,7 +368,7 @@ void CplexCallback::invoke(const IloCplex::Callback::Context& context)
             if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
             {
                 auto maxDev = env->reformulatedProblem->getMaxNumericConstraintValue(
-                    solution, env->reformulatedProblem->nonlinearConstraints);
+                    solution, env->reformulatedProblem->nonredundantNonlinearConstraints);
 
                 solutionCandidate.maxDeviation = PairIndexValue(maxDev.constraint->index, maxDev.normalizedValue);
             }
@@ -423,25 +520,8 @@ bool CplexCallback::createHyperplane(Hyperplane hyperplane, const IloCplex::Call
         }
     }
 
-    // Small fix to fix badly scaled cuts.
-    // TODO: this should be made so it also takes into account small/large coefficients of the linear terms
-    if(abs(tmpPair.second) > 1e15)
-    {
-        double scalingFactor = abs(tmpPair.second) - 1e15;
-
-        for(auto& E : tmpPair.first)
-            E.second /= scalingFactor;
-
-        tmpPair.second /= scalingFactor;
-
-        if(!warningMessageShownLargeRHS)
-        {
-            env->output->outputWarning(
-                "        Large values found in RHS of cut, you might want to consider reducing the "
-                "bounds of the nonlinear variables.");
-            warningMessageShownLargeRHS = true;
-        }
-    }
+    if(!env->dualSolver->MIPSolver->postProcessHyperplaneTerms(tmpPair.first, tmpPair.second))
+        return (false);
 
     try
     {
@@ -456,11 +536,6 @@ bool CplexCallback::createHyperplane(Hyperplane hyperplane, const IloCplex::Call
 
         context.rejectCandidate(tmpRange);
 
-        std::string identifier = env->dualSolver->MIPSolver->getConstraintIdentifier(hyperplane.source);
-
-        if(hyperplane.sourceConstraint != nullptr)
-            identifier = identifier + "_" + hyperplane.sourceConstraint->name;
-
         env->dualSolver->addGeneratedHyperplane(hyperplane);
 
         tmpRange.end();
@@ -488,12 +563,9 @@ bool CplexCallback::createIntegerCut(IntegerCut& integerCut, const IloCplex::Cal
         IloExpr expr(context.getEnv());
         size_t index = 0;
 
-        for(auto& VAR : env->reformulatedProblem->allVariables)
+        for(auto& I : integerCut.variableIndexes)
         {
-            if(!(VAR->properties.type == E_VariableType::Binary || VAR->properties.type == E_VariableType::Integer
-                   || VAR->properties.type == E_VariableType::Semiinteger))
-                continue;
-
+            auto VAR = env->reformulatedProblem->getVariable(I);
             int variableValue = integerCut.variableValues[index];
             auto variable = cplexVars[VAR->index];
 
@@ -531,27 +603,35 @@ void CplexCallback::addLazyConstraint(
 {
     try
     {
+        auto threadContext = getThreadContext(context);
+
         if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
         {
+            auto currentTaskSelectHPPts = (threadContext) ? threadContext->taskSelectHPPts : taskSelectHPPts;
 
             if(static_cast<ES_HyperplaneCutStrategy>(env->settings->getSetting<int>("CutStrategy", "Dual"))
                 == ES_HyperplaneCutStrategy::ESH)
             {
                 tUpdateInteriorPoint->run();
-                static_cast<TaskSelectHyperplanePointsESH*>(taskSelectHPPts.get())->run(candidatePoints);
+                static_cast<TaskSelectHyperplanePointsESH*>(currentTaskSelectHPPts.get())->run(candidatePoints);
             }
             else
             {
-                static_cast<TaskSelectHyperplanePointsECP*>(taskSelectHPPts.get())->run(candidatePoints);
+                static_cast<TaskSelectHyperplanePointsECP*>(currentTaskSelectHPPts.get())->run(candidatePoints);
             }
         }
 
         if(env->reformulatedProblem->objectiveFunction->properties.classification
             > E_ObjectiveFunctionClassification::Quadratic)
         {
-            taskSelectHPPtsByObjectiveRootsearch->run(candidatePoints);
+            if(threadContext)
+                threadContext->taskSelectHPPtsByObjectiveRootsearch->run(candidatePoints);
+            else
+                taskSelectHPPtsByObjectiveRootsearch->run(candidatePoints);
         }
 
+        std::lock_guard<std::recursive_mutex> waitingListLock(env->dualSolver->cutGenerationMutex);
+
         for(auto& hp : env->dualSolver->hyperplaneWaitingList)
         {
             this->createHyperplane(hp, context);
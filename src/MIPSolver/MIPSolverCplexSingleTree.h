@@ -44,6 +44,14 @@ private:
 protected:
 };
 
+// The cut generation tasks used by a single Cplex thread. Each task has its own root search method, so cuts can be
+// generated in parallel in the different threads.
+struct CplexCallbackThreadContext
+{
+    std::shared_ptr<TaskBase> taskSelectHPPts;
+    std::shared_ptr<TaskSelectHyperplanePointsObjectiveFunction> taskSelectHPPtsByObjectiveRootsearch;
+};
+
 class CplexCallback : public IloCplex::Callback::Function, public MIPSolverCallbackBase
 {
 
@@ -58,6 +66,11 @@ private:
     IloNumVarArray cplexVars;
     IloCplex cplexInst;
 
+    // Indexed by the Cplex thread id, and not modified after construction so no locking is needed when accessed
+    std::vector<CplexCallbackThreadContext> threadContexts;
+
+    CplexCallbackThreadContext* getThreadContext(const IloCplex::Callback::Context& context);
+
     bool createHyperplane(Hyperplane hyperplane, const IloCplex::Callback::Context& context);
     bool createIntegerCut(IntegerCut& integerCut, const IloCplex::Callback::Context& context);
 
@@ -125,7 +125,7 @@ void HCallbackI::main() // Called at each node...
         if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
         {
             auto maxDev = env->reformulatedProblem->getMaxNumericConstraintValue(
-                solution, env->reformulatedProblem->nonlinearConstraints);
+                solution, env->reformulatedProblem->nonredundantNonlinearConstraints);
             tmpSolPt.maxDeviation = PairIndexValue(maxDev.constraint->index, maxDev.normalizedValue);
         }
         else
@@ -301,7 +301,7 @@ void CtCallbackI::main()
     if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
     {
         auto maxDev = env->reformulatedProblem->getMaxNumericConstraintValue(
-            solution, env->reformulatedProblem->nonlinearConstraints);
+            solution, env->reformulatedProblem->nonredundantNonlinearConstraints);
 
         solutionCandidate.maxDeviation = PairIndexValue(maxDev.constraint->index, maxDev.normalizedValue);
     }
@@ -536,25 +536,8 @@ bool CtCallbackI::createHyperplane(Hyperplane hyperplane)
         }
     }
 
-    // Small fix to fix badly scaled cuts.
-    // TODO: this should be made so it also takes into account small/large coefficients of the linear terms
-    if(abs(tmpPair.second) > 1e15)
-    {
-        double scalingFactor = abs(tmpPair.second) - 1e15;
-
-        for(auto& E : tmpPair.first)
-            E.second /= scalingFactor;
-
-        tmpPair.second /= scalingFactor;
-
-        if(!warningMessageShownLargeRHS)
-        {
-            env->output->outputWarning(
-                "        Large values found in RHS of cut, you might want to consider reducing the "
-                "bounds of the nonlinear variables.");
-            warningMessageShownLargeRHS = true;
-        }
-    }
+    if(!env->dualSolver->MIPSolver->postProcessHyperplaneTerms(tmpPair.first, tmpPair.second))
+        return (false);
 
     auto currIter = env->results->getCurrentIteration(); // The unsolved new iteration
 
@@ -613,12 +596,9 @@ bool CtCallbackI::createIntegerCut(IntegerCut& integerCut)
         IloExpr expr(this->getEnv());
         size_t index = 0;
 
-        for(auto& VAR : env->reformulatedProblem->allVariables)
+        for(auto& I : integerCut.variableIndexes)
         {
-            if(!(VAR->properties.type == E_VariableType::Binary || VAR->properties.type == E_VariableType::Integer
-                   || VAR->properties.type == E_VariableType::Semiinteger))
-                continue;
-
+            auto VAR = env->reformulatedProblem->getVariable(I);
             int variableValue = integerCut.variableValues[index];
 
             if(variableValue == VAR->upperBound)
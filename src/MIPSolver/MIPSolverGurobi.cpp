@@ -1094,6 +1094,20 @@ void MIPSolverGurobi::setTimeLimit(double seconds)
     }
 }
 
+void MIPSolverGurobi::setRelativeGap(double gap)
+{
+    try
+    {
+        gurobiModel->getEnv().set(GRB_DoubleParam_MIPGap, gap);
+    }
+    catch(GRBException& e)
+    {
+        env->output->outputError("        Error when setting relative gap", e.getMessage());
+    }
+}
+
+double MIPSolverGurobi::getRelativeGap() { return (gurobiModel->getEnv().get(GRB_DoubleParam_MIPGap)); }
+
 void MIPSolverGurobi::setCutOff(double cutOff)
 {
     try
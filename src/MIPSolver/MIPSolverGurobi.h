@@ -78,6 +78,11 @@ public:
         return (MIPSolverBase::createHyperplaneTerms(hyperplane));
     }
 
+    bool postProcessHyperplaneTerms(std::map<int, double>& elements, double& constant) override
+    {
+        return (MIPSolverBase::postProcessHyperplaneTerms(elements, constant));
+    }
+
     void fixVariable(int varIndex, double value) override;
 
     void fixVariables(VectorInteger variableIndexes, VectorDouble variableValues) override
@@ -121,6 +126,9 @@ public:
 
     void setTimeLimit(double seconds) override;
 
+    void setRelativeGap(double gap) override;
+    double getRelativeGap() override;
+
     void setCutOff(double cutOff) override;
     void setCutOffAsConstraint(double cutOff) override;
 
@@ -289,7 +289,7 @@ void GurobiCallbackSingleTree::callback()
                 if(env->problem->properties.numberOfNonlinearConstraints > 0)
                 {
                     auto maxDev = env->reformulatedProblem->getMaxNumericConstraintValue(
-                        solution, env->reformulatedProblem->nonlinearConstraints);
+                        solution, env->reformulatedProblem->nonredundantNonlinearConstraints);
                     solutionRelaxed.maxDeviation = PairIndexValue(maxDev.constraint->index, maxDev.normalizedValue);
                 }
                 else
@@ -356,7 +356,7 @@ void GurobiCallbackSingleTree::callback()
             if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
             {
                 auto maxDev = env->reformulatedProblem->getMaxNumericConstraintValue(
-                    solution, env->reformulatedProblem->nonlinearConstraints);
+                    solution, env->reformulatedProblem->nonredundantNonlinearConstraints);
 
                 solutionCandidate.maxDeviation = PairIndexValue(maxDev.constraint->index, maxDev.normalizedValue);
             }
@@ -500,25 +500,8 @@ bool GurobiCallbackSingleTree::createHyperplane(Hyperplane hyperplane)
             }
         }
 
-        // Small fix to fix badly scaled cuts.
-        // TODO: this should be made so it also takes into account small/large coefficients of the linear terms
-        if(abs(tmpPair.second) > 1e15)
-        {
-            double scalingFactor = abs(tmpPair.second) - 1e15;
-
-            for(auto& E : tmpPair.first)
-                E.second /= scalingFactor;
-
-            tmpPair.second /= scalingFactor;
-
-            if(!warningMessageShownLargeRHS)
-            {
-                env->output->outputWarning(
-                    "        Large values found in RHS of cut, you might want to consider reducing the "
-                    "bounds of the nonlinear variables.");
-                warningMessageShownLargeRHS = true;
-            }
-        }
+        if(!env->dualSolver->MIPSolver->postProcessHyperplaneTerms(tmpPair.first, tmpPair.second))
+            return (false);
 
         GRBLinExpr expr = 0;
 
@@ -611,12 +594,9 @@ bool GurobiCallbackSingleTree::createIntegerCut(IntegerCut& integerCut)
         GRBLinExpr expr = 0;
         size_t index = 0;
 
-        for(auto& VAR : env->reformulatedProblem->allVariables)
+        for(auto& I : integerCut.variableIndexes)
         {
-            if(!(VAR->properties.type == E_VariableType::Binary || VAR->properties.type == E_VariableType::Integer
-                   || VAR->properties.type == E_VariableType::Semiinteger))
-                continue;
-
+            auto VAR = env->reformulatedProblem->getVariable(I);
             int variableValue = integerCut.variableValues[index];
             auto variable = vars[VAR->index];
 
@@ -42,6 +42,240 @@ Interval AuxiliaryVariable::calculate(const IntervalVector& intervalVector) cons
     return interval;
 }
 
+void AuxiliaryVariableProgram::clear()
+{
+    compiled = false;
+    instructions.clear();
+    factorIndexes.clear();
+    factorPowers.clear();
+    expressions.clear();
+}
+
+void AuxiliaryVariableProgram::compile(
+    const AuxiliaryVariables& variables, const AuxiliaryVariablePtr& objectiveVariable, bool negateObjectiveVariable)
+{
+    clear();
+
+    int maxIndex = -1;
+
+    for(auto& V : variables)
+        maxIndex = std::max(maxIndex, V->index);
+
+    // Maps a variable index to the position of the auxiliary variable in the list, or -1 if not auxiliary
+    std::vector<int> auxiliaryPosition(maxIndex + 1, -1);
+
+    for(size_t i = 0; i < variables.size(); i++)
+        auxiliaryPosition[variables[i]->index] = i;
+
+    std::vector<std::vector<int>> dependencies(variables.size());
+
+    for(size_t i = 0; i < variables.size(); i++)
+    {
+        auto& V = variables[i];
+
+        Variables usedVariables;
+
+        for(auto& T : V->linearTerms)
+            usedVariables.push_back(T->variable);
+
+        for(auto& T : V->quadraticTerms)
+        {
+            usedVariables.push_back(T->firstVariable);
+            usedVariables.push_back(T->secondVariable);
+        }
+
+        for(auto& T : V->monomialTerms)
+        {
+            for(auto& F : T->variables)
+                usedVariables.push_back(F);
+        }
+
+        for(auto& T : V->signomialTerms)
+        {
+            for(auto& E : T->elements)
+                usedVariables.push_back(E->variable);
+        }
+
+        if(V->nonlinearExpression)
+            V->nonlinearExpression->appendNonlinearVariables(usedVariables);
+
+        for(auto& U : usedVariables)
+        {
+            if(U->index <= maxIndex && auxiliaryPosition[U->index] >= 0 && U->index != V->index)
+                dependencies[i].push_back(auxiliaryPosition[U->index]);
+        }
+    }
+
+    // Depth-first topological sort, the original order is kept whenever possible
+    std::vector<int> state(variables.size(), 0); // 0 = not visited, 1 = in progress, 2 = done
+    std::vector<std::pair<int, size_t>> stack;
+
+    for(size_t i = 0; i < variables.size(); i++)
+    {
+        if(state[i] != 0)
+            continue;
+
+        stack.emplace_back(i, 0);
+        state[i] = 1;
+
+        while(!stack.empty())
+        {
+            auto& [position, nextDependency] = stack.back();
+
+            if(nextDependency < dependencies[position].size())
+            {
+                int dependency = dependencies[position][nextDependency];
+                nextDependency++;
+
+                // A dependency that is in progress would be a cycle, and is ignored
+                if(state[dependency] == 0)
+                {
+                    state[dependency] = 1;
+                    stack.emplace_back(dependency, 0);
+                }
+
+                continue;
+            }
+
+            state[position] = 2;
+            compile(variables[position]);
+            stack.pop_back();
+        }
+    }
+
+    if(objectiveVariable)
+    {
+        compile(objectiveVariable);
+
+        if(negateObjectiveVariable)
+            instructions.push_back({ E_InstructionType::Negate, objectiveVariable->index });
+    }
+
+    compiled = true;
+}
+
+void AuxiliaryVariableProgram::compile(const AuxiliaryVariablePtr& variable)
+{
+    int target = variable->index;
+
+    instructions.push_back({ E_InstructionType::Constant, target, -1, -1, variable->constant });
+
+    for(auto& T : variable->linearTerms)
+        instructions.push_back({ E_InstructionType::Linear, target, T->variable->index, -1, T->coefficient });
+
+    for(auto& T : variable->quadraticTerms)
+    {
+        instructions.push_back({ E_InstructionType::Quadratic, target, T->firstVariable->index,
+            T->secondVariable->index, T->coefficient });
+    }
+
+    for(auto& T : variable->monomialTerms)
+    {
+        instructions.push_back({ E_InstructionType::Monomial, target, (int)factorIndexes.size(),
+            (int)T->variables.size(), T->coefficient });
+
+        for(auto& V : T->variables)
+        {
+            factorIndexes.push_back(V->index);
+            factorPowers.push_back(1.0);
+        }
+    }
+
+    for(auto& T : variable->signomialTerms)
+    {
+        instructions.push_back({ E_InstructionType::Signomial, target, (int)factorIndexes.size(),
+            (int)T->elements.size(), T->coefficient });
+
+        for(auto& E : T->elements)
+        {
+            factorIndexes.push_back(E->variable->index);
+            factorPowers.push_back(E->power);
+        }
+    }
+
+    if(variable->nonlinearExpression)
+    {
+        instructions.push_back({ E_InstructionType::Nonlinear, target, (int)expressions.size(), -1, 1.0 });
+        expressions.push_back(variable->nonlinearExpression);
+    }
+}
+
+inline double AuxiliaryVariableProgram::executeInstruction(
+    const Instruction& instruction, const VectorDouble& point) const
+{
+    double value = instruction.coefficient;
+
+    switch(instruction.type)
+    {
+    case E_InstructionType::Linear:
+        value *= point[instruction.first];
+        break;
+
+    case E_InstructionType::Quadratic:
+        value *= point[instruction.first] * point[instruction.second];
+        break;
+
+    case E_InstructionType::Monomial:
+        for(int i = instruction.first; i < instruction.first + instruction.second; i++)
+            value *= point[factorIndexes[i]];
+        break;
+
+    case E_InstructionType::Signomial:
+        for(int i = instruction.first; i < instruction.first + instruction.second; i++)
+            value *= pow(point[factorIndexes[i]], factorPowers[i]);
+        break;
+
+    case E_InstructionType::Nonlinear:
+        value = expressions[instruction.first]->calculate(point);
+        break;
+
+    default:
+        break;
+    }
+
+    return (value);
+}
+
+void AuxiliaryVariableProgram::execute(VectorDouble& point) const
+{
+    assert(compiled);
+
+    for(auto& I : instructions)
+    {
+        if(I.type == E_InstructionType::Constant)
+            point[I.target] = I.coefficient;
+        else if(I.type == E_InstructionType::Negate)
+            point[I.target] = -point[I.target];
+        else
+            point[I.target] += executeInstruction(I, point);
+    }
+}
+
+void AuxiliaryVariableProgram::execute(std::vector<VectorDouble>& points) const
+{
+    assert(compiled);
+
+    // Executes one instruction at a time for all points, so that the instruction stream is only traversed once
+    for(auto& I : instructions)
+    {
+        if(I.type == E_InstructionType::Constant)
+        {
+            for(auto& P : points)
+                P[I.target] = I.coefficient;
+        }
+        else if(I.type == E_InstructionType::Negate)
+        {
+            for(auto& P : points)
+                P[I.target] = -P[I.target];
+        }
+        else
+        {
+            for(auto& P : points)
+                P[I.target] += executeInstruction(I, P);
+        }
+    }
+}
+
 std::ostream& operator<<(std::ostream& stream, AuxiliaryVariablePtr var)
 {
     stream << "[" << var->index << "]:\t";
@@ -111,6 +111,56 @@ public:
     }
 };
 
+// A flat representation of the auxiliary variable definitions, topologically ordered so that an auxiliary variable
+// is always calculated after the auxiliary variables it depends on. Used to fill in the values of all auxiliary
+// variables in a point without evaluating the term objects one by one.
+class AuxiliaryVariableProgram
+{
+public:
+    void clear();
+
+    void compile(const AuxiliaryVariables& variables, const AuxiliaryVariablePtr& objectiveVariable = nullptr,
+        bool negateObjectiveVariable = false);
+
+    // The point must already be allocated so that it contains all the variables
+    void execute(VectorDouble& point) const;
+    void execute(std::vector<VectorDouble>& points) const;
+
+    inline bool isCompiled() const { return (compiled); }
+
+private:
+    enum class E_InstructionType
+    {
+        Constant,
+        Linear,
+        Quadratic,
+        Monomial,
+        Signomial,
+        Nonlinear,
+        Negate
+    };
+
+    struct Instruction
+    {
+        E_InstructionType type;
+        int target; // The variable to add the value to
+        int first = -1; // Variable index, or offset in factorIndexes/expressions
+        int second = -1; // Variable index, or number of factors
+        double coefficient = 0.0;
+    };
+
+    bool compiled = false;
+
+    std::vector<Instruction> instructions;
+
+    std::vector<int> factorIndexes;
+    VectorDouble factorPowers;
+    std::vector<NonlinearExpressionPtr> expressions;
+
+    void compile(const AuxiliaryVariablePtr& variable);
+    inline double executeInstruction(const Instruction& instruction, const VectorDouble& point) const;
+};
+
 std::ostream& operator<<(std::ostream& stream, AuxiliaryVariablePtr var);
 
 } // namespace SHOT
\ No newline at end of file
@@ -0,0 +1,398 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "CompiledExpressions.h"
+
+#include "../Output.h"
+#include "../Settings.h"
+#include "../Utilities.h"
+
+#include "spdlog/fmt/fmt.h"
+
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <sstream>
+
+#ifdef HAS_JIT
+#include <dlfcn.h>
+#endif
+
+#ifdef HAS_STD_FILESYSTEM
+#include <filesystem>
+namespace fs = std;
+#endif
+
+#ifdef HAS_STD_EXPERIMENTAL_FILESYSTEM
+#include <experimental/filesystem>
+namespace fs = std::experimental;
+#endif
+
+namespace SHOT
+{
+
+void CompiledExpression::calculateGradient(const VectorDouble& point, SparseVariableVector& gradient) const
+{
+    VectorDouble values(variables.size(), 0.0);
+    gradientFunction(point.data(), values.data());
+
+    for(size_t i = 0; i < variables.size(); i++)
+    {
+        if(values[i] == 0.0)
+            continue;
+
+        auto element = gradient.emplace(variables[i], values[i]);
+
+        if(!element.second)
+        {
+            // Element already exists for the variable
+            element.first->second += values[i];
+        }
+    }
+}
+
+CompiledExpressions::CompiledExpressions(EnvironmentPtr envPtr) : env(envPtr) { }
+
+std::vector<CompiledExpressionPtr> CompiledExpressions::compile(
+    const std::vector<std::pair<NonlinearExpressionPtr, Variables>>& expressions)
+{
+    std::vector<CompiledExpressionPtr> compiledExpressions;
+
+    if(expressions.size() == 0)
+        return (compiledExpressions);
+
+    std::stringstream code;
+    code << "#include <math.h>\n\n";
+
+    for(size_t i = 0; i < expressions.size(); i++)
+    {
+        if(!generateCode(code, i, expressions[i].first, expressions[i].second))
+        {
+            env->output->outputDebug(" Nonlinear expressions cannot be compiled, using ordinary evaluation.");
+            return (compiledExpressions);
+        }
+    }
+
+    auto library = loadLibrary(code.str());
+
+    if(!library)
+        return (compiledExpressions);
+
+#ifdef HAS_JIT
+    for(size_t i = 0; i < expressions.size(); i++)
+    {
+        auto compiledExpression = std::make_shared<CompiledExpression>();
+
+        compiledExpression->valueFunction = reinterpret_cast<CompiledExpression::ValueFunction>(
+            dlsym(library.get(), fmt::format("shot_value_{}", i).c_str()));
+        compiledExpression->gradientFunction = reinterpret_cast<CompiledExpression::GradientFunction>(
+            dlsym(library.get(), fmt::format("shot_gradient_{}", i).c_str()));
+
+        if(compiledExpression->valueFunction == nullptr || compiledExpression->gradientFunction == nullptr)
+        {
+            env->output->outputWarning(" Could not find the compiled functions for the nonlinear expressions.");
+            return (std::vector<CompiledExpressionPtr>());
+        }
+
+        compiledExpression->variables = expressions[i].second;
+        compiledExpression->library = library;
+
+        compiledExpressions.push_back(compiledExpression);
+    }
+#endif
+
+    env->output->outputDebug(fmt::format(" Compiled {} nonlinear expressions to native code.", expressions.size()));
+
+    return (compiledExpressions);
+}
+
+bool CompiledExpressions::generateCode(std::stringstream& code, int functionIndex,
+    const NonlinearExpressionPtr& expression, const Variables& variables)
+{
+    std::map<int, int> gradientPositions;
+
+    for(size_t i = 0; i < variables.size(); i++)
+        gradientPositions.emplace(variables[i]->index, i);
+
+    // Every node in the expression becomes a temporary t_i in the forward sweep, and its adjoint a_i is propagated to
+    // the children in the reverse sweep. Shared subexpressions are only calculated once.
+    std::map<const NonlinearExpression*, int> nodeIds;
+    VectorString forwardStatements;
+    VectorString reverseStatements;
+
+    bool isSupported = true;
+
+    std::function<int(const NonlinearExpression*)> visit = [&](const NonlinearExpression* node) -> int {
+        if(auto nodeId = nodeIds.find(node); nodeId != nodeIds.end())
+            return (nodeId->second);
+
+        std::vector<int> c;
+
+        if(auto unary = dynamic_cast<const ExpressionUnary*>(node))
+        {
+            c.push_back(visit(unary->child.get()));
+        }
+        else if(auto binary = dynamic_cast<const ExpressionBinary*>(node))
+        {
+            c.push_back(visit(binary->firstChild.get()));
+            c.push_back(visit(binary->secondChild.get()));
+        }
+        else if(auto general = dynamic_cast<const ExpressionGeneral*>(node))
+        {
+            for(auto& C : general->children)
+                c.push_back(visit(C.get()));
+        }
+
+        int id = forwardStatements.size();
+
+        std::string value;
+        std::stringstream adjoint;
+
+        switch(node->getType())
+        {
+        case E_NonlinearExpressionTypes::Constant:
+        {
+            double constant = static_cast<const ExpressionConstant*>(node)->constant;
+
+            if(!std::isfinite(constant))
+                isSupported = false;
+
+            value = fmt::format("({:.17g})", constant);
+            break;
+        }
+        case E_NonlinearExpressionTypes::Variable:
+        {
+            int variableIndex = static_cast<const ExpressionVariable*>(node)->variable->index;
+            value = fmt::format("x[{}]", variableIndex);
+
+            if(auto position = gradientPositions.find(variableIndex); position != gradientPositions.end())
+                adjoint << fmt::format("    g[{}] += a{};\n", position->second, id);
+            else
+                isSupported = false;
+
+            break;
+        }
+        case E_NonlinearExpressionTypes::Negate:
+            value = fmt::format("-t{}", c[0]);
+            adjoint << fmt::format("    a{} -= a{};\n", c[0], id);
+            break;
+        case E_NonlinearExpressionTypes::Invert:
+            value = fmt::format("1.0 / t{}", c[0]);
+            adjoint << fmt::format("    a{0} -= a{1} * t{1} * t{1};\n", c[0], id);
+            break;
+        case E_NonlinearExpressionTypes::SquareRoot:
+            value = fmt::format("sqrt(t{})", c[0]);
+            adjoint << fmt::format("    a{0} += 0.5 * a{1} / t{1};\n", c[0], id);
+            break;
+        case E_NonlinearExpressionTypes::Log:
+            value = fmt::format("log(t{})", c[0]);
+            adjoint << fmt::format("    a{0} += a{1} / t{0};\n", c[0], id);
+            break;
+        case E_NonlinearExpressionTypes::Exp:
+            value = fmt::format("exp(t{})", c[0]);
+            adjoint << fmt::format("    a{0} += a{1} * t{1};\n", c[0], id);
+            break;
+        case E_NonlinearExpressionTypes::Square:
+            value = fmt::format("t{0} * t{0}", c[0]);
+            adjoint << fmt::format("    a{0} += 2.0 * a{1} * t{0};\n", c[0], id);
+            break;
+        case E_NonlinearExpressionTypes::Cos:
+            value = fmt::format("cos(t{})", c[0]);
+            adjoint << fmt::format("    a{0} -= a{1} * sin(t{0});\n", c[0], id);
+            break;
+        case E_NonlinearExpressionTypes::Sin:
+            value = fmt::format("sin(t{})", c[0]);
+            adjoint << fmt::format("    a{0} += a{1} * cos(t{0});\n", c[0], id);
+            break;
+        case E_NonlinearExpressionTypes::Tan:
+            value = fmt::format("tan(t{})", c[0]);
+            adjoint << fmt::format("    a{0} += a{1} * (1.0 + t{1} * t{1});\n", c[0], id);
+            break;
+        case E_NonlinearExpressionTypes::ArcCos:
+            value = fmt::format("acos(t{})", c[0]);
+            adjoint << fmt::format("    a{0} -= a{1} / sqrt(1.0 - t{0} * t{0});\n", c[0], id);
+            break;
+        case E_NonlinearExpressionTypes::ArcSin:
+            value = fmt::format("asin(t{})", c[0]);
+            adjoint << fmt::format("    a{0} += a{1} / sqrt(1.0 - t{0} * t{0});\n", c[0], id);
+            break;
+        case E_NonlinearExpressionTypes::ArcTan:
+            value = fmt::format("atan(t{})", c[0]);
+            adjoint << fmt::format("    a{0} += a{1} / (1.0 + t{0} * t{0});\n", c[0], id);
+            break;
+        case E_NonlinearExpressionTypes::Abs:
+            value = fmt::format("fabs(t{})", c[0]);
+            adjoint << fmt::format("    a{0} += a{1} * ((t{0} > 0.0) - (t{0} < 0.0));\n", c[0], id);
+            break;
+        case E_NonlinearExpressionTypes::Divide:
+            value = fmt::format("t{} / t{}", c[0], c[1]);
+            adjoint << fmt::format("    a{0} += a{2} / t{1};\n", c[0], c[1], id);
+            adjoint << fmt::format("    a{1} -= a{2} * t{2} / t{1};\n", c[0], c[1], id);
+            break;
+        case E_NonlinearExpressionTypes::Power:
+            value = fmt::format("pow(t{}, t{})", c[0], c[1]);
+            adjoint << fmt::format("    a{0} += a{2} * t{1} * pow(t{0}, t{1} - 1.0);\n", c[0], c[1], id);
+
+            if(static_cast<const ExpressionBinary*>(node)->secondChild->getType()
+                != E_NonlinearExpressionTypes::Constant)
+            {
+                adjoint << fmt::format(
+                    "    a{1} += (t{0} > 0.0) ? a{2} * t{2} * log(t{0}) : 0.0;\n", c[0], c[1], id);
+            }
+
+            break;
+        case E_NonlinearExpressionTypes::Sum:
+            value = (c.size() == 0) ? "0.0" : "";
+
+            for(size_t i = 0; i < c.size(); i++)
+            {
+                value += (i == 0) ? fmt::format("t{}", c[i]) : fmt::format(" + t{}", c[i]);
+                adjoint << fmt::format("    a{} += a{};\n", c[i], id);
+            }
+
+            break;
+        case E_NonlinearExpressionTypes::Product:
+            value = (c.size() == 0) ? "1.0" : "";
+
+            for(size_t i = 0; i < c.size(); i++)
+            {
+                value += (i == 0) ? fmt::format("t{}", c[i]) : fmt::format(" * t{}", c[i]);
+
+                adjoint << fmt::format("    a{} += a{}", c[i], id);
+
+                for(size_t j = 0; j < c.size(); j++)
+                {
+                    if(j != i)
+                        adjoint << fmt::format(" * t{}", c[j]);
+                }
+
+                adjoint << ";\n";
+            }
+
+            break;
+        default:
+            isSupported = false;
+            break;
+        }
+
+        forwardStatements.push_back(fmt::format("    const double t{} = {};\n", id, value));
+        reverseStatements.push_back(adjoint.str());
+        nodeIds.emplace(node, id);
+
+        return (id);
+    };
+
+    int root = visit(expression.get());
+
+    if(!isSupported)
+        return (false);
+
+    std::stringstream forwardSweep;
+
+    for(auto& S : forwardStatements)
+        forwardSweep << S;
+
+    code << fmt::format("double shot_value_{}(const double* x)\n{{\n", functionIndex);
+    code << forwardSweep.str();
+    code << fmt::format("    return t{};\n}}\n\n", root);
+
+    code << fmt::format("double shot_gradient_{}(const double* x, double* g)\n{{\n", functionIndex);
+    code << forwardSweep.str();
+
+    for(size_t i = 0; i < forwardStatements.size(); i++)
+        code << fmt::format("    double a{} = {};\n", i, ((int)i == root) ? "1.0" : "0.0");
+
+    for(size_t i = 0; i < variables.size(); i++)
+        code << fmt::format("    g[{}] = 0.0;\n", i);
+
+    for(int i = reverseStatements.size() - 1; i >= 0; i--)
+        code << reverseStatements[i];
+
+    code << fmt::format("    return t{};\n}}\n\n", root);
+
+    return (true);
+}
+
+std::shared_ptr<void> CompiledExpressions::loadLibrary([[maybe_unused]] const std::string& sourceCode)
+{
+#ifdef HAS_JIT
+    std::string cachePath = env->settings->getSetting<std::string>("JIT.CachePath", "Model");
+
+    fs::filesystem::path cacheDirectory
+        = (cachePath == "") ? fs::filesystem::temp_directory_path() : fs::filesystem::path(cachePath);
+
+    // The libraries are identified by a hash of the generated code, i.e., of the structure of the expressions
+    std::string baseName = fmt::format("SHOT_JIT_{:016x}", std::hash<std::string> {}(sourceCode));
+
+    auto sourcePath = cacheDirectory / (baseName + ".c");
+    auto libraryPath = cacheDirectory / (baseName + ".so");
+
+    std::error_code errorCode;
+
+    bool isCached = fs::filesystem::exists(libraryPath, errorCode) && fs::filesystem::exists(sourcePath, errorCode)
+        && Utilities::getFileAsString(sourcePath.string()) == sourceCode;
+
+    if(isCached)
+    {
+        env->output->outputDebug(" Using cached compiled nonlinear expressions in " + libraryPath.string());
+    }
+    else
+    {
+        if(!Utilities::writeStringToFile(sourcePath.string(), sourceCode))
+        {
+            env->output->outputWarning(" Could not write the generated code to " + sourcePath.string());
+            return (nullptr);
+        }
+
+        // Compiles to a temporary file first, so that concurrent processes never load a partially written library
+        std::random_device randomDevice;
+        auto temporaryPath = cacheDirectory / fmt::format("{}_{:x}.so", baseName, randomDevice());
+
+        std::string command = fmt::format("{} {} -shared -fPIC -o \"{}\" \"{}\" -lm",
+            env->settings->getSetting<std::string>("JIT.Compiler", "Model"),
+            env->settings->getSetting<std::string>("JIT.CompilerFlags", "Model"), temporaryPath.string(),
+            sourcePath.string());
+
+        env->output->outputDebug(" Compiling nonlinear expressions: " + command);
+
+        if(std::system(command.c_str()) != 0)
+        {
+            env->output->outputWarning(" Could not compile the nonlinear expressions, using ordinary evaluation.");
+            fs::filesystem::remove(temporaryPath, errorCode);
+            return (nullptr);
+        }
+
+        fs::filesystem::rename(temporaryPath, libraryPath, errorCode);
+
+        if(errorCode)
+        {
+            env->output->outputWarning(" Could not store the compiled nonlinear expressions in " + libraryPath.string());
+            fs::filesystem::remove(temporaryPath, errorCode);
+            return (nullptr);
+        }
+    }
+
+    void* handle = dlopen(libraryPath.string().c_str(), RTLD_NOW | RTLD_LOCAL);
+
+    if(handle == nullptr)
+    {
+        env->output->outputWarning(fmt::format(" Could not load the compiled nonlinear expressions: {}", dlerror()));
+        return (nullptr);
+    }
+
+    return (std::shared_ptr<void>(handle, [](void* library) { dlclose(library); }));
+#else
+    env->output->outputWarning(
+        " Compilation of nonlinear expressions is not available since SHOT was built without HAS_JIT.");
+    return (nullptr);
+#endif
+}
+
+} // namespace SHOT
@@ -0,0 +1,72 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+
+#include "../Environment.h"
+#include "../Structs.h"
+
+#include "Variables.h"
+#include "NonlinearExpressions.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SHOT
+{
+
+// A nonlinear expression that has been compiled to native code by CompiledExpressions
+class CompiledExpression
+{
+public:
+    using ValueFunction = double (*)(const double*);
+    using GradientFunction = double (*)(const double*, double*);
+
+    ValueFunction valueFunction = nullptr;
+    GradientFunction gradientFunction = nullptr; // Calculates the gradient w.r.t. variables and returns the value
+
+    Variables variables;
+
+    std::shared_ptr<void> library; // Keeps the shared library loaded for as long as the functions are in use
+
+    inline double calculateValue(const VectorDouble& point) const { return (valueFunction(point.data())); }
+
+    // Adds the gradient of the expression to the given sparse gradient
+    void calculateGradient(const VectorDouble& point, SparseVariableVector& gradient) const;
+};
+
+using CompiledExpressionPtr = std::shared_ptr<CompiledExpression>;
+
+// Generates C code for the values and gradients of nonlinear expressions, compiles it with the system compiler into a
+// shared library and loads it. The libraries are cached in a directory and reused if a model with the same structure
+// is solved again.
+class CompiledExpressions
+{
+public:
+    CompiledExpressions(EnvironmentPtr envPtr);
+
+    // The variables given for each expression determine the order of the elements in the gradient. Returns an empty
+    // vector if the code could not be generated, compiled or loaded, in which case the ordinary evaluation is used.
+    std::vector<CompiledExpressionPtr> compile(
+        const std::vector<std::pair<NonlinearExpressionPtr, Variables>>& expressions);
+
+private:
+    EnvironmentPtr env;
+
+    bool generateCode(std::stringstream& code, int functionIndex, const NonlinearExpressionPtr& expression,
+        const Variables& variables);
+
+    std::shared_ptr<void> loadLibrary(const std::string& sourceCode);
+};
+
+} // namespace SHOT
@@ -183,6 +183,20 @@ bool NumericConstraint::isFulfilled(const VectorDouble& point)
     return (constraintValue.isFulfilledLHS && constraintValue.isFulfilledRHS);
 }
 
+bool NumericConstraint::isProvenInfeasible(const IntervalVector& intervalVector, double tolerance)
+{
+    try
+    {
+        auto value = calculateFunctionValue(intervalVector);
+
+        return (value.l() > valueRHS + tolerance || value.u() < valueLHS - tolerance);
+    }
+    catch(const mc::Interval::Exceptions&)
+    {
+        return (false);
+    }
+}
+
 void LinearConstraint::add(LinearTerms terms)
 {
     if(linearTerms.size() == 0)
@@ -599,7 +613,9 @@ double NonlinearConstraint::calculateFunctionValue(const VectorDouble& point)
     if(this->properties.hasSignomialTerms)
         value += signomialTerms.calculate(point);
 
-    if(this->properties.hasNonlinearExpression)
+    if(this->properties.hasNonlinearExpression && compiledNonlinearExpression)
+        value += compiledNonlinearExpression->calculateValue(point);
+    else if(this->properties.hasNonlinearExpression)
         value += nonlinearExpression->calculate(point);
 
     return value;
@@ -648,27 +664,26 @@ SparseVariableVector NonlinearConstraint::calculateGradient(const VectorDouble&
 {
     SparseVariableVector gradient = QuadraticConstraint::calculateGradient(point, eraseZeroes);
 
-    SparseVariableVector monomialGradient;
-
     if(this->properties.hasMonomialTerms)
-    {
-        monomialGradient = monomialTerms.calculateGradient(point);
-    }
-
-    SparseVariableVector signomialGradient;
+        monomialTerms.calculateGradient(point, gradient);
 
     if(this->properties.hasSignomialTerms)
+        signomialTerms.calculateGradient(point, gradient);
+
+    if(this->properties.hasNonlinearExpression && compiledNonlinearExpression)
     {
-        signomialGradient = signomialTerms.calculateGradient(point);
+        compiledNonlinearExpression->calculateGradient(point, gradient);
     }
-
-    if(this->properties.hasNonlinearExpression)
+    else if(this->properties.hasNonlinearExpression)
     {
         if(!nonlinearGradientSparsityMapGenerated)
             initializeGradientSparsityPattern();
 
         if(auto sharedOwnerProblem = ownerProblem.lock())
         {
+            sharedOwnerProblem->prepareFactorableFunctions();
+            std::lock_guard<std::recursive_mutex> lock(sharedOwnerProblem->getFactorableFunctionsMutex());
+
             int numberOfNonlinearVariables = sharedOwnerProblem->properties.numberOfVariablesInNonlinearExpressions;
 
             std::vector<double> pointNonlinearSubset(numberOfNonlinearVariables, 0.0);
@@ -704,12 +719,10 @@ SparseVariableVector NonlinearConstraint::calculateGradient(const VectorDouble&
         }
     }
 
-    auto result = Utilities::combineSparseVariableVectors(gradient, monomialGradient, signomialGradient);
-
     if(eraseZeroes)
-        Utilities::erase_if<VariablePtr, double>(result, 0.0);
+        Utilities::erase_if<VariablePtr, double>(gradient, 0.0);
 
-    return result;
+    return gradient;
 }
 
 void NonlinearConstraint::initializeGradientSparsityPattern()
@@ -752,6 +765,9 @@ void NonlinearConstraint::initializeGradientSparsityPattern()
     {
         if(auto sharedOwnerProblem = ownerProblem.lock())
         {
+            sharedOwnerProblem->prepareFactorableFunctions();
+            std::lock_guard<std::recursive_mutex> lock(sharedOwnerProblem->getFactorableFunctionsMutex());
+
             assert(sharedOwnerProblem->properties.numberOfVariablesInNonlinearExpressions > 0);
             assert(sharedOwnerProblem->properties.numberOfNonlinearExpressions > 0);
             assert(this->nonlinearExpressionIndex >= 0);
@@ -801,14 +817,10 @@ SparseVariableMatrix NonlinearConstraint::calculateHessian(const VectorDouble& p
     SparseVariableMatrix hessian = QuadraticConstraint::calculateHessian(point, eraseZeroes);
 
     if(properties.hasMonomialTerms)
-    {
-        hessian = Utilities::combineSparseVariableMatrices(monomialTerms.calculateHessian(point), hessian);
-    }
+        monomialTerms.calculateHessian(point, hessian);
 
     if(properties.hasSignomialTerms)
-    {
-        hessian = Utilities::combineSparseVariableMatrices(signomialTerms.calculateHessian(point), hessian);
-    }
+        signomialTerms.calculateHessian(point, hessian);
 
     if(this->properties.hasNonlinearExpression)
     {
@@ -817,6 +829,9 @@ SparseVariableMatrix NonlinearConstraint::calculateHessian(const VectorDouble& p
 
         if(auto sharedOwnerProblem = ownerProblem.lock())
         {
+            sharedOwnerProblem->prepareFactorableFunctions();
+            std::lock_guard<std::recursive_mutex> lock(sharedOwnerProblem->getFactorableFunctionsMutex());
+
             int numberOfNonlinearVariables = sharedOwnerProblem->properties.numberOfVariablesInNonlinearExpressions;
 
             std::vector<double> pointNonlinearSubset(numberOfNonlinearVariables, 0.0);
@@ -922,6 +937,9 @@ void NonlinearConstraint::initializeHessianSparsityPattern()
     {
         if(auto sharedOwnerProblem = ownerProblem.lock())
         {
+            sharedOwnerProblem->prepareFactorableFunctions();
+            std::lock_guard<std::recursive_mutex> lock(sharedOwnerProblem->getFactorableFunctionsMutex());
+
             // For some reason we need to have all nonlinear variables activated, otherwise not all nonzero elements of
             // the hessian may be detected
             auto nonlinearVariablesInExpressionMap
@@ -19,6 +19,7 @@
 #include "Variables.h"
 #include "Terms.h"
 #include "NonlinearExpressions.h"
+#include "CompiledExpressions.h"
 
 #include "cppad/cppad.hpp"
 #include "cppad/utility.hpp"
@@ -61,6 +62,8 @@ struct ConstraintProperties
     bool hasSignomialTerms = false;
     bool hasNonlinearExpression = false;
     bool hasNonalgebraicPart = false; // E.g. for external functions
+
+    bool isRedundant = false; // Cannot be violated within the current variable bounds
 };
 
 class Constraint
@@ -142,6 +145,10 @@ public:
 
     bool isFulfilled(const VectorDouble& point) override;
 
+    // Whether interval evaluation proves that the constraint is violated in every point within the bounds. Returns
+    // false if the evaluation fails, e.g., since a function is not defined for all values within the bounds.
+    bool isProvenInfeasible(const IntervalVector& intervalVector, double tolerance);
+
     void takeOwnership(ProblemPtr owner) override = 0;
 
     virtual std::shared_ptr<NumericConstraint> getPointer() = 0;
@@ -300,6 +307,7 @@ public:
 
     NonlinearExpressionPtr nonlinearExpression;
     FactorableFunctionPtr factorableFunction;
+    CompiledExpressionPtr compiledNonlinearExpression; // Set if the nonlinear expression has been compiled
 
     CppAD::sparse_rc<std::vector<size_t>> nonlinearGradientSparsityPattern;
     CppAD::sparse_rc<std::vector<size_t>> nonlinearHessianSparsityPattern;
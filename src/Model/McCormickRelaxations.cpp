@@ -0,0 +1,305 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "McCormickRelaxations.h"
+
+#include "../Output.h"
+
+#include "Constraints.h"
+#include "NonlinearExpressions.h"
+#include "Terms.h"
+#include "Variables.h"
+
+#include "mccormick.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace SHOT
+{
+
+using McCormick = mc::McCormick<Interval>;
+
+McCormickRelaxations::McCormickRelaxations(EnvironmentPtr envPtr) : env(envPtr) { }
+
+std::optional<std::pair<std::map<int, double>, double>> McCormickRelaxations::calculateLinearization(
+    const NumericConstraintPtr& constraint, const VectorDouble& point, bool isOverestimator)
+{
+    auto linearConstraint = std::dynamic_pointer_cast<LinearConstraint>(constraint);
+
+    if(!linearConstraint)
+        return (std::nullopt);
+
+    auto quadraticConstraint = std::dynamic_pointer_cast<QuadraticConstraint>(constraint);
+    auto nonlinearConstraint = std::dynamic_pointer_cast<NonlinearConstraint>(constraint);
+
+    // The variables in the nonlinear parts of the function, whose positions give the elements in the subgradients
+    Variables variables;
+
+    auto appendVariable = [&](const VariablePtr& variable) {
+        if(std::find(variables.begin(), variables.end(), variable) == variables.end())
+            variables.push_back(variable);
+    };
+
+    if(quadraticConstraint)
+    {
+        for(auto& T : quadraticConstraint->quadraticTerms)
+        {
+            appendVariable(T->firstVariable);
+            appendVariable(T->secondVariable);
+        }
+    }
+
+    if(nonlinearConstraint)
+    {
+        for(auto& T : nonlinearConstraint->monomialTerms)
+        {
+            for(auto& V : T->variables)
+                appendVariable(V);
+        }
+
+        for(auto& T : nonlinearConstraint->signomialTerms)
+        {
+            for(auto& E : T->elements)
+                appendVariable(E->variable);
+        }
+
+        if(nonlinearConstraint->nonlinearExpression)
+            nonlinearConstraint->nonlinearExpression->appendNonlinearVariables(variables);
+    }
+
+    std::map<int, double> elements;
+    double constant = linearConstraint->constant;
+
+    for(auto& T : linearConstraint->linearTerms)
+        elements[T->variable->index] += T->coefficient;
+
+    if(variables.size() == 0)
+        return (std::make_pair(elements, constant));
+
+    std::map<VariablePtr, McCormick> relaxedVariables;
+    VectorDouble relaxationPoint(variables.size());
+
+    for(size_t i = 0; i < variables.size(); i++)
+    {
+        auto& V = variables[i];
+
+        // The relaxations are only defined for bounded variables
+        if(!(V->lowerBound > SHOT_DBL_MIN && V->upperBound < SHOT_DBL_MAX && V->lowerBound <= V->upperBound))
+            return (std::nullopt);
+
+        // The point may be slightly outside of the bounds due to tolerances in the MIP solver
+        relaxationPoint[i] = std::clamp(point.at(V->index), V->lowerBound, V->upperBound);
+
+        McCormick variable(Interval(V->lowerBound, V->upperBound), relaxationPoint[i]);
+        variable.sub(variables.size(), i);
+        relaxedVariables.emplace(V, variable);
+    }
+
+    bool isSupported = true;
+
+    // Shared subexpressions are only relaxed once
+    std::map<const NonlinearExpression*, McCormick> relaxedNodes;
+
+    std::function<McCormick(const NonlinearExpression*)> relax = [&](const NonlinearExpression* node) -> McCormick {
+        if(auto relaxedNode = relaxedNodes.find(node); relaxedNode != relaxedNodes.end())
+            return (relaxedNode->second);
+
+        McCormick value;
+
+        switch(node->getType())
+        {
+        case E_NonlinearExpressionTypes::Constant:
+            value = McCormick(static_cast<const ExpressionConstant*>(node)->constant);
+            break;
+        case E_NonlinearExpressionTypes::Variable:
+            value = relaxedVariables.at(static_cast<const ExpressionVariable*>(node)->variable);
+            break;
+        case E_NonlinearExpressionTypes::Negate:
+            value = -relax(static_cast<const ExpressionUnary*>(node)->child.get());
+            break;
+        case E_NonlinearExpressionTypes::Invert:
+            value = inv(relax(static_cast<const ExpressionUnary*>(node)->child.get()));
+            break;
+        case E_NonlinearExpressionTypes::SquareRoot:
+            value = sqrt(relax(static_cast<const ExpressionUnary*>(node)->child.get()));
+            break;
+        case E_NonlinearExpressionTypes::Log:
+            value = log(relax(static_cast<const ExpressionUnary*>(node)->child.get()));
+            break;
+        case E_NonlinearExpressionTypes::Exp:
+            value = exp(relax(static_cast<const ExpressionUnary*>(node)->child.get()));
+            break;
+        case E_NonlinearExpressionTypes::Square:
+            value = sqr(relax(static_cast<const ExpressionUnary*>(node)->child.get()));
+            break;
+        case E_NonlinearExpressionTypes::Cos:
+            value = cos(relax(static_cast<const ExpressionUnary*>(node)->child.get()));
+            break;
+        case E_NonlinearExpressionTypes::Sin:
+            value = sin(relax(static_cast<const ExpressionUnary*>(node)->child.get()));
+            break;
+        case E_NonlinearExpressionTypes::Tan:
+            value = tan(relax(static_cast<const ExpressionUnary*>(node)->child.get()));
+            break;
+        case E_NonlinearExpressionTypes::ArcCos:
+            value = acos(relax(static_cast<const ExpressionUnary*>(node)->child.get()));
+            break;
+        case E_NonlinearExpressionTypes::ArcSin:
+            value = asin(relax(static_cast<const ExpressionUnary*>(node)->child.get()));
+            break;
+        case E_NonlinearExpressionTypes::ArcTan:
+            value = atan(relax(static_cast<const ExpressionUnary*>(node)->child.get()));
+            break;
+        case E_NonlinearExpressionTypes::Abs:
+            value = fabs(relax(static_cast<const ExpressionUnary*>(node)->child.get()));
+            break;
+        case E_NonlinearExpressionTypes::Divide:
+        {
+            auto binary = static_cast<const ExpressionBinary*>(node);
+            value = relax(binary->firstChild.get()) / relax(binary->secondChild.get());
+            break;
+        }
+        case E_NonlinearExpressionTypes::Power:
+        {
+            auto binary = static_cast<const ExpressionBinary*>(node);
+            auto base = relax(binary->firstChild.get());
+
+            if(binary->secondChild->getType() == E_NonlinearExpressionTypes::Constant)
+            {
+                double exponent = static_cast<const ExpressionConstant*>(binary->secondChild.get())->constant;
+
+                // Integer powers have tighter relaxations, and are also defined for nonpositive bases
+                if(exponent == std::round(exponent) && std::abs(exponent) < 1000)
+                    value = pow(base, (int)exponent);
+                else
+                    value = pow(base, exponent);
+            }
+            else
+            {
+                value = pow(base, relax(binary->secondChild.get()));
+            }
+
+            break;
+        }
+        case E_NonlinearExpressionTypes::Sum:
+            value = McCormick(0.0);
+
+            for(auto& C : static_cast<const ExpressionGeneral*>(node)->children)
+                value += relax(C.get());
+
+            break;
+        case E_NonlinearExpressionTypes::Product:
+            value = McCormick(1.0);
+
+            for(auto& C : static_cast<const ExpressionGeneral*>(node)->children)
+                value *= relax(C.get());
+
+            break;
+        default:
+            isSupported = false;
+            value = McCormick(0.0);
+            break;
+        }
+
+        relaxedNodes.emplace(node, value);
+        return (value);
+    };
+
+    McCormick function(0.0);
+
+    try
+    {
+        if(quadraticConstraint)
+        {
+            for(auto& T : quadraticConstraint->quadraticTerms)
+            {
+                if(T->isSquare)
+                    function += T->coefficient * sqr(relaxedVariables.at(T->firstVariable));
+                else
+                    function += T->coefficient
+                        * (relaxedVariables.at(T->firstVariable) * relaxedVariables.at(T->secondVariable));
+            }
+        }
+
+        if(nonlinearConstraint)
+        {
+            for(auto& T : nonlinearConstraint->monomialTerms)
+            {
+                McCormick product(1.0);
+
+                for(auto& V : T->variables)
+                    product *= relaxedVariables.at(V);
+
+                function += T->coefficient * product;
+            }
+
+            for(auto& T : nonlinearConstraint->signomialTerms)
+            {
+                McCormick product(1.0);
+
+                for(auto& E : T->elements)
+                {
+                    if(E->power == std::round(E->power) && std::abs(E->power) < 1000)
+                        product *= pow(relaxedVariables.at(E->variable), (int)E->power);
+                    else
+                        product *= pow(relaxedVariables.at(E->variable), E->power);
+                }
+
+                function += T->coefficient * product;
+            }
+
+            if(nonlinearConstraint->nonlinearExpression)
+                function += relax(nonlinearConstraint->nonlinearExpression.get());
+        }
+    }
+    catch(McCormick::Exceptions& e)
+    {
+        env->output->outputTrace("        McCormick relaxation of constraint " + constraint->name
+            + " could not be calculated: " + e.what());
+        return (std::nullopt);
+    }
+    catch(const mc::Interval::Exceptions&)
+    {
+        env->output->outputTrace(
+            "        McCormick relaxation of constraint " + constraint->name + " could not be calculated.");
+        return (std::nullopt);
+    }
+
+    if(!isSupported)
+        return (std::nullopt);
+
+    // The relaxation only contains constants if the nonlinear parts are fixed by the bounds
+    double relaxationValue = isOverestimator ? function.cc() : function.cv();
+
+    if(!std::isfinite(relaxationValue))
+        return (std::nullopt);
+
+    constant += relaxationValue;
+
+    for(size_t i = 0; i < variables.size(); i++)
+    {
+        double subgradient = (function.nsub() == 0) ? 0.0 : (isOverestimator ? function.ccsub(i) : function.cvsub(i));
+
+        if(!std::isfinite(subgradient))
+            return (std::nullopt);
+
+        if(subgradient == 0.0)
+            continue;
+
+        elements[variables[i]->index] += subgradient;
+        constant -= subgradient * relaxationPoint[i];
+    }
+
+    return (std::make_pair(elements, constant));
+}
+
+} // namespace SHOT
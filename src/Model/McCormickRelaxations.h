@@ -0,0 +1,43 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+
+#include "../Environment.h"
+#include "../Structs.h"
+
+#include <map>
+#include <optional>
+#include <utility>
+
+namespace SHOT
+{
+
+// Calculates linearizations of the McCormick relaxations of constraint functions with the McCormick arithmetic in mc++.
+// The convex underestimator and concave overestimator of a function are valid within the whole box given by the
+// variable bounds, so unlike the linearizations of the function itself, the linearizations of the relaxations give
+// valid cuts also for nonconvex constraints.
+class McCormickRelaxations
+{
+public:
+    McCormickRelaxations(EnvironmentPtr envPtr);
+
+    // Returns the linearization sum(a_i*x_i) + constant in the point of the convex underestimator of the constraint
+    // function, or of the concave overestimator if isOverestimator is true. The linear terms are included exactly.
+    // Returns an empty optional if the relaxation cannot be calculated, e.g., since a variable in a nonlinear term is
+    // unbounded or a function is undefined within the bounds.
+    std::optional<std::pair<std::map<int, double>, double>> calculateLinearization(
+        const NumericConstraintPtr& constraint, const VectorDouble& point, bool isOverestimator);
+
+private:
+    EnvironmentPtr env;
+};
+
+} // namespace SHOT
@@ -326,6 +326,7 @@ void QuadraticObjectiveFunction::add(QuadraticTerms terms)
     {
         quadraticTerms = terms;
         properties.isValid = false;
+        pointEvaluator.reset();
     }
     else
     {
@@ -340,6 +341,7 @@ void QuadraticObjectiveFunction::add(QuadraticTermPtr term)
 {
     quadraticTerms.push_back(term);
     properties.isValid = false;
+    pointEvaluator.reset();
 }
 
 void QuadraticObjectiveFunction::updateProperties()
@@ -384,6 +386,125 @@ void QuadraticObjectiveFunction::updateProperties()
     {
         properties.hasQuadraticTerms = false;
     }
+
+    createPointEvaluator();
+}
+
+void QuadraticObjectiveFunction::createPointEvaluator()
+{
+    auto evaluator = std::make_shared<PointEvaluator>();
+
+    evaluator->linearTermsVersion = linearTerms.getVersion();
+    evaluator->quadraticTermsVersion = quadraticTerms.getVersion();
+
+    int maximumVariableIndex = -1;
+
+    for(auto& T : linearTerms)
+    {
+        evaluator->linearVariableIndexes.push_back(T->variable->index);
+        evaluator->linearCoefficients.push_back(T->coefficient);
+        maximumVariableIndex = std::max(maximumVariableIndex, T->variable->index);
+    }
+
+    for(auto& T : quadraticTerms)
+    {
+        evaluator->quadraticVariableIndexes.emplace_back(T->firstVariable->index, T->secondVariable->index);
+        evaluator->quadraticCoefficients.push_back(T->coefficient);
+        maximumVariableIndex
+            = std::max({ maximumVariableIndex, T->firstVariable->index, T->secondVariable->index });
+    }
+
+    // The eigendecomposition is of the Hessian of the quadratic terms, so they equal 0.5 * sum_k lambda_k * (v_k'x)^2.
+    // It is only used if the number of nonzero eigenvalues times the number of variables, i.e., the cost of the dot
+    // products, is less than the number of terms.
+    size_t numberOfVariables = quadraticTerms.variableMap.size();
+
+    if(numberOfVariables > 0 && (size_t)quadraticTerms.eigenvalues.size() == numberOfVariables
+        && (size_t)quadraticTerms.eigenvectors.rows() == numberOfVariables)
+    {
+        double maximumEigenvalue = quadraticTerms.eigenvalues.cwiseAbs().maxCoeff();
+
+        std::vector<int> nonzeroEigenvalues;
+
+        for(size_t k = 0; k < numberOfVariables; k++)
+        {
+            if(std::abs(quadraticTerms.eigenvalues(k).real()) > 1e-10 * maximumEigenvalue)
+                nonzeroEigenvalues.push_back(k);
+        }
+
+        if(nonzeroEigenvalues.size() * numberOfVariables < quadraticTerms.size())
+        {
+            evaluator->eigenvectorVariableIndexes.resize(numberOfVariables);
+
+            for(auto& [VAR, localIndex] : quadraticTerms.variableMap)
+                evaluator->eigenvectorVariableIndexes[localIndex] = VAR->index;
+
+            for(auto k : nonzeroEigenvalues)
+            {
+                evaluator->eigenvalueFactors.push_back(0.5 * quadraticTerms.eigenvalues(k).real());
+
+                for(size_t i = 0; i < numberOfVariables; i++)
+                    evaluator->eigenvectors.push_back(quadraticTerms.eigenvectors(i, k).real());
+            }
+
+            // The decomposition may be of an earlier version of the terms, so it is verified in a test point
+            VectorDouble testPoint(maximumVariableIndex + 1);
+
+            for(size_t i = 0; i < testPoint.size(); i++)
+                testPoint[i] = 1.0 + 0.1 * (i % 7);
+
+            double factorizedValue = evaluator->calculate(testPoint);
+            double value = linearTerms.calculate(testPoint) + quadraticTerms.calculate(testPoint);
+
+            if(std::abs(factorizedValue - value) > 1e-8 * std::max(1.0, std::abs(value)))
+            {
+                evaluator->eigenvectorVariableIndexes.clear();
+                evaluator->eigenvalueFactors.clear();
+                evaluator->eigenvectors.clear();
+            }
+        }
+    }
+
+    pointEvaluator = evaluator;
+}
+
+double QuadraticObjectiveFunction::PointEvaluator::calculate(const VectorDouble& point) const
+{
+    double value = 0.0;
+
+    for(size_t i = 0; i < linearCoefficients.size(); i++)
+        value += linearCoefficients[i] * point[linearVariableIndexes[i]];
+
+    if(eigenvalueFactors.empty())
+    {
+        for(size_t i = 0; i < quadraticCoefficients.size(); i++)
+        {
+            value += quadraticCoefficients[i] * point[quadraticVariableIndexes[i].first]
+                * point[quadraticVariableIndexes[i].second];
+        }
+
+        return (value);
+    }
+
+    size_t numberOfVariables = eigenvectorVariableIndexes.size();
+
+    VectorDouble localPoint(numberOfVariables);
+
+    for(size_t i = 0; i < numberOfVariables; i++)
+        localPoint[i] = point[eigenvectorVariableIndexes[i]];
+
+    for(size_t k = 0; k < eigenvalueFactors.size(); k++)
+    {
+        const double* eigenvector = &eigenvectors[k * numberOfVariables];
+        double product = 0.0;
+
+        for(size_t i = 0; i < numberOfVariables; i++)
+            product += eigenvector[i] * localPoint[i];
+
+        value += eigenvalueFactors[k] * product * product;
+    }
+
+    return (value);
 }
 
 bool QuadraticObjectiveFunction::isDualUnbounded()
@@ -414,6 +535,11 @@ void QuadraticObjectiveFunction::takeOwnership(ProblemPtr owner)
 
 double QuadraticObjectiveFunction::calculateValue(const VectorDouble& point)
 {
+    // The terms may have been changed through the term containers since the evaluator was created
+    if(pointEvaluator && pointEvaluator->linearTermsVersion == linearTerms.getVersion()
+        && pointEvaluator->quadraticTermsVersion == quadraticTerms.getVersion())
+        return (constant + pointEvaluator->calculate(point));
+
     double value = LinearObjectiveFunction::calculateValue(point);
     value += quadraticTerms.calculate(point);
     return value;
@@ -757,7 +883,9 @@ double NonlinearObjectiveFunction::calculateValue(const VectorDouble& point)
     value += monomialTerms.calculate(point);
     value += signomialTerms.calculate(point);
 
-    if(this->properties.hasNonlinearExpression)
+    if(this->properties.hasNonlinearExpression && compiledNonlinearExpression)
+        value += compiledNonlinearExpression->calculateValue(point);
+    else if(this->properties.hasNonlinearExpression)
         value += nonlinearExpression->calculate(point);
 
     return value;
@@ -786,13 +914,20 @@ SparseVariableVector NonlinearObjectiveFunction::calculateGradient(const VectorD
 {
     SparseVariableVector gradient = QuadraticObjectiveFunction::calculateGradient(point, eraseZeroes);
 
-    if(this->properties.hasNonlinearExpression)
+    if(this->properties.hasNonlinearExpression && compiledNonlinearExpression)
+    {
+        compiledNonlinearExpression->calculateGradient(point, gradient);
+    }
+    else if(this->properties.hasNonlinearExpression)
     {
         if(!nonlinearGradientSparsityMapGenerated)
             initializeGradientSparsityPattern();
 
         if(auto sharedOwnerProblem = ownerProblem.lock())
         {
+            sharedOwnerProblem->prepareFactorableFunctions();
+            std::lock_guard<std::recursive_mutex> lock(sharedOwnerProblem->getFactorableFunctionsMutex());
+
             int numberOfNonlinearVariables = sharedOwnerProblem->properties.numberOfVariablesInNonlinearExpressions;
 
             std::vector<double> pointNonlinearSubset(numberOfNonlinearVariables, 0.0);
@@ -828,26 +963,16 @@ SparseVariableVector NonlinearObjectiveFunction::calculateGradient(const VectorD
         }
     }
 
-    SparseVariableVector monomialGradient;
-
     if(this->properties.hasMonomialTerms)
-    {
-        monomialGradient = monomialTerms.calculateGradient(point);
-    }
-
-    SparseVariableVector signomialGradient;
+        monomialTerms.calculateGradient(point, gradient);
 
     if(this->properties.hasSignomialTerms)
-    {
-        signomialGradient = signomialTerms.calculateGradient(point);
-    }
-
-    auto result = Utilities::combineSparseVariableVectors(gradient, monomialGradient, signomialGradient);
+        signomialTerms.calculateGradient(point, gradient);
 
     if(eraseZeroes)
         Utilities::erase_if<VariablePtr, double>(gradient, 0.0);
 
-    return result;
+    return gradient;
 }
 
 void NonlinearObjectiveFunction::initializeGradientSparsityPattern()
@@ -917,6 +1042,9 @@ void NonlinearObjectiveFunction::initializeGradientSparsityPattern()
     {
         if(auto sharedOwnerProblem = ownerProblem.lock())
         {
+            sharedOwnerProblem->prepareFactorableFunctions();
+            std::lock_guard<std::recursive_mutex> lock(sharedOwnerProblem->getFactorableFunctionsMutex());
+
             assert(sharedOwnerProblem->properties.numberOfVariablesInNonlinearExpressions > 0);
             assert(sharedOwnerProblem->properties.numberOfNonlinearExpressions > 0);
             assert(this->nonlinearExpressionIndex >= 0);
@@ -983,14 +1111,10 @@ SparseVariableMatrix NonlinearObjectiveFunction::calculateHessian(const VectorDo
     SparseVariableMatrix hessian = QuadraticObjectiveFunction::calculateHessian(point, eraseZeroes);
 
     if(properties.hasMonomialTerms)
-    {
-        hessian = Utilities::combineSparseVariableMatrices(monomialTerms.calculateHessian(point), hessian);
-    }
+        monomialTerms.calculateHessian(point, hessian);
 
     if(properties.hasSignomialTerms)
-    {
-        hessian = Utilities::combineSparseVariableMatrices(signomialTerms.calculateHessian(point), hessian);
-    }
+        signomialTerms.calculateHessian(point, hessian);
 
     if(this->properties.hasNonlinearExpression)
     {
@@ -999,6 +1123,9 @@ SparseVariableMatrix NonlinearObjectiveFunction::calculateHessian(const VectorDo
 
         if(auto sharedOwnerProblem = ownerProblem.lock())
         {
+            sharedOwnerProblem->prepareFactorableFunctions();
+            std::lock_guard<std::recursive_mutex> lock(sharedOwnerProblem->getFactorableFunctionsMutex());
+
             int numberOfNonlinearVariables = sharedOwnerProblem->properties.numberOfVariablesInNonlinearExpressions;
 
             std::vector<double> pointNonlinearSubset(numberOfNonlinearVariables, 0.0);
@@ -1102,6 +1229,9 @@ void NonlinearObjectiveFunction::initializeHessianSparsityPattern()
     {
         if(auto sharedOwnerProblem = ownerProblem.lock())
         {
+            sharedOwnerProblem->prepareFactorableFunctions();
+            std::lock_guard<std::recursive_mutex> lock(sharedOwnerProblem->getFactorableFunctionsMutex());
+
             // For some reason we need to have all nonlinear variables activated, otherwise not all nonzero elements of
             // the hessian may be detected
             auto nonlinearVariablesInExpressionMap
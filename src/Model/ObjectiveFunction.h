@@ -14,6 +14,7 @@
 #include "Variables.h"
 #include "Terms.h"
 #include "NonlinearExpressions.h"
+#include "CompiledExpressions.h"
 
 #include <vector>
 
@@ -256,6 +257,32 @@ public:
 protected:
     void initializeGradientSparsityPattern() override;
     void initializeHessianSparsityPattern() override;
+
+private:
+    // Flat copies of the linear and quadratic terms, used when calculating the value in a point. If the quadratic terms
+    // have low rank, they are instead calculated from their eigendecomposition as a weighted sum of squares.
+    struct PointEvaluator
+    {
+        // The versions of the term containers the evaluator was created from
+        size_t linearTermsVersion = 0;
+        size_t quadraticTermsVersion = 0;
+
+        std::vector<int> linearVariableIndexes;
+        VectorDouble linearCoefficients;
+
+        std::vector<std::pair<int, int>> quadraticVariableIndexes;
+        VectorDouble quadraticCoefficients;
+
+        std::vector<int> eigenvectorVariableIndexes;
+        VectorDouble eigenvalueFactors;
+        VectorDouble eigenvectors; // Row-major, with one row per eigenvalue factor
+
+        double calculate(const VectorDouble& point) const;
+    };
+
+    std::shared_ptr<PointEvaluator> pointEvaluator;
+
+    void createPointEvaluator();
 };
 
 using QuadraticObjectiveFunctionPtr = std::shared_ptr<QuadraticObjectiveFunction>;
@@ -343,6 +370,7 @@ public:
 
     NonlinearExpressionPtr nonlinearExpression;
     FactorableFunctionPtr factorableFunction;
+    CompiledExpressionPtr compiledNonlinearExpression; // Set if the nonlinear expression has been compiled
 
     CppAD::sparse_rc<std::vector<size_t>> nonlinearGradientSparsityPattern;
     CppAD::sparse_rc<std::vector<size_t>> nonlinearHessianSparsityPattern;
@@ -12,6 +12,8 @@
 #include "../Enums.h"
 #include "../Output.h"
 #include "../Settings.h"
+#include "../TaskHandler.h"
+#include "../ThreadPool.h"
 #include "../Timing.h"
 #include "../Utilities.h"
 #include "../Model/Simplifications.h"
@@ -280,11 +282,14 @@ void Problem::updateConstraints()
     this->objectiveFunction->takeOwnership(shared_from_this());
 
     env->output->outputTrace(" Updating all constraints");
+
+    // The constraint properties, e.g., convexity, are independent of each other and are updated in parallel. Nothing
+    // is logged in the worker threads.
+    env->threadPool->parallelFor(
+        numericConstraints.size(), [&](size_t i) { numericConstraints[i]->updateProperties(); }, 50);
+
     for(auto& C : numericConstraints)
-    {
-        C->updateProperties();
         C->takeOwnership(shared_from_this());
-    }
 }
 
 void Problem::updateConvexity()
@@ -568,6 +573,11 @@ void Problem::updateVariables()
 void Problem::updateProperties()
 {
     env->output->outputTrace("Started updating properties of problem");
+
+    if(env->settings)
+        quadraticEigenvalueTolerance
+            = env->settings->getSetting<double>("Convexity.Quadratics.EigenValueTolerance", "Model");
+
     objectiveFunction->updateProperties();
 
     env->output->outputTrace("Updating constraints");
@@ -766,6 +776,9 @@ void Problem::updateProperties()
 
 void Problem::updateFactorableFunctions()
 {
+    factorableFunctions.clear();
+    constraintsWithNonlinearExpressions.clear();
+
     if(properties.numberOfVariablesInNonlinearExpressions == 0)
         return;
 
@@ -821,6 +834,58 @@ void Problem::updateFactorableFunctions()
     CppAD::AD<double>::abort_recording();
 }
 
+void Problem::updateCompiledExpressions()
+{
+    if(!env->settings->getSetting<bool>("JIT.Use", "Model"))
+        return;
+
+    std::vector<std::pair<NonlinearExpressionPtr, Variables>> expressions;
+
+    for(auto& C : nonlinearConstraints)
+    {
+        if(C->properties.hasNonlinearExpression && C->variablesInNonlinearExpression.size() > 0)
+            expressions.emplace_back(C->nonlinearExpression, C->variablesInNonlinearExpression);
+    }
+
+    auto objective = std::dynamic_pointer_cast<NonlinearObjectiveFunction>(objectiveFunction);
+
+    if(objective && objective->properties.hasNonlinearExpression
+        && objective->variablesInNonlinearExpression.size() > 0)
+        expressions.emplace_back(objective->nonlinearExpression, objective->variablesInNonlinearExpression);
+
+    auto compiledExpressions = CompiledExpressions(env).compile(expressions);
+
+    if(compiledExpressions.size() != expressions.size())
+        return; // The ordinary evaluation is used instead
+
+    size_t expressionCounter = 0;
+
+    for(auto& C : nonlinearConstraints)
+    {
+        if(C->properties.hasNonlinearExpression && C->variablesInNonlinearExpression.size() > 0)
+            C->compiledNonlinearExpression = compiledExpressions[expressionCounter++];
+    }
+
+    if(expressionCounter < compiledExpressions.size())
+        objective->compiledNonlinearExpression = compiledExpressions[expressionCounter];
+}
+
+void Problem::prepareFactorableFunctions()
+{
+    if(factorableFunctionsPrepared)
+        return;
+
+    std::lock_guard<std::recursive_mutex> lock(getFactorableFunctionsMutex());
+
+    if(factorableFunctionsPrepared)
+        return;
+
+    std::lock_guard<std::mutex> recordingLock(factorableFunctionsRecordingMutex);
+
+    updateFactorableFunctions();
+    factorableFunctionsPrepared = true;
+}
+
 Problem::Problem(EnvironmentPtr env) : env(env) { }
 
 Problem::~Problem()
@@ -851,7 +916,14 @@ Problem::~Problem()
 void Problem::finalize()
 {
     updateProperties();
-    updateFactorableFunctions();
+
+    // The tape is recorded by prepareFactorableFunctions() when the first derivative is needed
+    factorableFunctionsPrepared = false;
+    variableConstraintIncidenceCreated = false;
+
+    updateCompiledExpressions();
+    updateAuxiliaryVariableProgram();
+    updateRedundantConstraints();
     assert(verifyOwnership());
 
     if(env->settings->getSetting<bool>("Debug.Enable", "Output"))
@@ -944,16 +1016,19 @@ void Problem::add(NumericConstraintPtr constraint)
 {
     constraint->index = numericConstraints.size();
     numericConstraints.push_back(constraint);
+    nonredundantNumericConstraints.push_back(constraint);
 
     if(constraint->properties.hasNonlinearExpression || constraint->properties.hasMonomialTerms
         || constraint->properties.hasSignomialTerms)
     {
         nonlinearConstraints.push_back(std::dynamic_pointer_cast<NonlinearConstraint>(constraint));
+        nonredundantNonlinearConstraints.push_back(nonlinearConstraints.back());
     }
     else if(constraint->properties.hasQuadraticTerms
         && constraint->properties.classification >= E_ConstraintClassification::QuadraticConsideredAsNonlinear)
     {
         nonlinearConstraints.push_back(std::dynamic_pointer_cast<NonlinearConstraint>(constraint));
+        nonredundantNonlinearConstraints.push_back(nonlinearConstraints.back());
     }
     else if(constraint->properties.hasQuadraticTerms)
     {
@@ -973,6 +1048,7 @@ void Problem::add(LinearConstraintPtr constraint)
 {
     constraint->index = numericConstraints.size();
     numericConstraints.push_back(std::dynamic_pointer_cast<NumericConstraint>(constraint));
+    nonredundantNumericConstraints.push_back(numericConstraints.back());
     linearConstraints.push_back(constraint);
 
     constraint->takeOwnership(shared_from_this());
@@ -984,6 +1060,7 @@ void Problem::add(QuadraticConstraintPtr constraint)
 {
     constraint->index = numericConstraints.size();
     numericConstraints.push_back(std::dynamic_pointer_cast<NumericConstraint>(constraint));
+    nonredundantNumericConstraints.push_back(numericConstraints.back());
     quadraticConstraints.push_back(constraint);
 
     constraint->takeOwnership(shared_from_this());
@@ -995,7 +1072,9 @@ void Problem::add(NonlinearConstraintPtr constraint)
 {
     constraint->index = numericConstraints.size();
     numericConstraints.push_back(std::dynamic_pointer_cast<NumericConstraint>(constraint));
+    nonredundantNumericConstraints.push_back(numericConstraints.back());
     nonlinearConstraints.push_back(constraint);
+    nonredundantNonlinearConstraints.push_back(constraint);
 
     constraint->takeOwnership(shared_from_this());
 
@@ -1133,18 +1212,28 @@ AuxiliaryVariables Problem::getAuxiliaryVariablesOfType(E_AuxiliaryVariableType
 
 void Problem::setVariableLowerBound(int variableIndex, double bound)
 {
+    if(bound < allVariables.at(variableIndex)->lowerBound)
+        clearRedundantConstraints();
+
     allVariables.at(variableIndex)->lowerBound = bound;
     variablesUpdated = true;
 }
 
 void Problem::setVariableUpperBound(int variableIndex, double bound)
 {
+    if(bound > allVariables.at(variableIndex)->upperBound)
+        clearRedundantConstraints();
+
     allVariables.at(variableIndex)->upperBound = bound;
     variablesUpdated = true;
 }
 
 void Problem::setVariableBounds(int variableIndex, double lowerBound, double upperBound)
 {
+    if(lowerBound < allVariables.at(variableIndex)->lowerBound
+        || upperBound > allVariables.at(variableIndex)->upperBound)
+        clearRedundantConstraints();
+
     allVariables.at(variableIndex)->lowerBound = lowerBound;
     allVariables.at(variableIndex)->upperBound = upperBound;
     variablesUpdated = true;
@@ -1564,6 +1653,121 @@ NumericConstraintValue Problem::getMaxNumericConstraintValue(const VectorDouble&
     return value;
 }
 
+VectorDouble Problem::getMaxNumericConstraintValues(
+    const std::vector<VectorDouble>& points, const std::vector<NumericConstraint*>& constraintSelection)
+{
+    assert(constraintSelection.size() > 0);
+
+    VectorDouble values(points.size(), SHOT_DBL_MIN);
+
+    // The points are only evaluated in parallel if there are enough constraints to make it worthwhile
+    size_t minimumPointsPerThread = std::max((size_t)1, 200 / constraintSelection.size());
+
+    env->threadPool->parallelFor(
+        points.size(),
+        [&](size_t i) {
+            for(auto& C : constraintSelection)
+                values[i] = std::max(values[i], C->calculateNumericValue(points[i]).normalizedValue);
+        },
+        minimumPointsPerThread);
+
+    return values;
+}
+
+void Problem::updateVariableConstraintIncidence()
+{
+    variableConstraintIncidence.clear();
+    variableConstraintIncidence.resize(allVariables.size());
+
+    auto addIncidence = [&](const VariablePtr& variable, NumericConstraint* constraint) {
+        auto& constraints = variableConstraintIncidence[variable->index];
+
+        // A variable may be in several terms of the same constraint
+        if(constraints.empty() || constraints.back() != constraint)
+            constraints.push_back(constraint);
+    };
+
+    for(auto& C : numericConstraints)
+    {
+        auto constraint = C.get();
+
+        if(auto linearConstraint = dynamic_cast<LinearConstraint*>(constraint))
+        {
+            for(auto& T : linearConstraint->linearTerms)
+                addIncidence(T->variable, constraint);
+        }
+
+        if(auto quadraticConstraint = dynamic_cast<QuadraticConstraint*>(constraint))
+        {
+            for(auto& T : quadraticConstraint->quadraticTerms)
+            {
+                addIncidence(T->firstVariable, constraint);
+                addIncidence(T->secondVariable, constraint);
+            }
+        }
+
+        if(auto nonlinearConstraint = dynamic_cast<NonlinearConstraint*>(constraint))
+        {
+            for(auto& V : nonlinearConstraint->variablesInMonomialTerms)
+                addIncidence(V, constraint);
+
+            for(auto& V : nonlinearConstraint->variablesInSignomialTerms)
+                addIncidence(V, constraint);
+
+            for(auto& V : nonlinearConstraint->variablesInNonlinearExpression)
+                addIncidence(V, constraint);
+        }
+    }
+}
+
+const std::vector<NumericConstraint*>& Problem::getConstraintsWithVariable(int variableIndex)
+{
+    if(!variableConstraintIncidenceCreated)
+    {
+        std::lock_guard<std::mutex> lock(variableConstraintIncidenceMutex);
+
+        if(!variableConstraintIncidenceCreated)
+        {
+            updateVariableConstraintIncidence();
+            variableConstraintIncidenceCreated = true;
+        }
+    }
+
+    return (variableConstraintIncidence.at(variableIndex));
+}
+
+NumericConstraintValues Problem::getNumericConstraintValues(const VectorDouble& point)
+{
+    NumericConstraintValues constraintValues;
+    constraintValues.reserve(numericConstraints.size());
+
+    for(auto& C : numericConstraints)
+        constraintValues.push_back(C->calculateNumericValue(point));
+
+    return (constraintValues);
+}
+
+void Problem::updateNumericConstraintValues(
+    const VectorDouble& point, const VectorInteger& changedVariableIndexes, NumericConstraintValues& constraintValues)
+{
+    assert(constraintValues.size() == numericConstraints.size());
+
+    std::vector<NumericConstraint*> affectedConstraints;
+
+    for(auto I : changedVariableIndexes)
+    {
+        auto& constraints = getConstraintsWithVariable(I);
+        affectedConstraints.insert(affectedConstraints.end(), constraints.begin(), constraints.end());
+    }
+
+    std::sort(affectedConstraints.begin(), affectedConstraints.end());
+    affectedConstraints.erase(
+        std::unique(affectedConstraints.begin(), affectedConstraints.end()), affectedConstraints.end());
+
+    for(auto C : affectedConstraints)
+        constraintValues[C->index] = C->calculateNumericValue(point);
+}
+
 template <typename T>
 NumericConstraintValues Problem::getAllDeviatingConstraints(
     const VectorDouble& point, double tolerance, std::vector<T> constraintSelection, double correction)
@@ -1587,9 +1791,9 @@ NumericConstraintValues Problem::getFractionOfDeviatingNonlinearConstraints(
     else if(fraction < 0)
         fraction = 0;
 
-    int fractionNumbers = std::max(1, (int)ceil(fraction * this->nonlinearConstraints.size()));
+    int fractionNumbers = std::max(1, (int)ceil(fraction * this->nonredundantNonlinearConstraints.size()));
 
-    auto values = getAllDeviatingConstraints(point, tolerance, this->nonlinearConstraints, correction);
+    auto values = getAllDeviatingConstraints(point, tolerance, this->nonredundantNonlinearConstraints, correction);
 
     std::sort(values.begin(), values.end(), std::greater<NumericConstraintValue>());
 
@@ -1756,7 +1960,9 @@ void Problem::doFBBT()
     }
 
     int numberOfIterations = env->settings->getSetting<int>("BoundTightening.FeasibilityBased.MaxIterations", "Model");
-    double timeLimit = env->settings->getSetting<double>("BoundTightening.FeasibilityBased.TimeLimit", "Model");
+    // The bound tightening may not run past the time limit of the solver
+    double timeLimit = std::min(env->tasks->getRemainingTime(),
+        env->settings->getSetting<double>("BoundTightening.FeasibilityBased.TimeLimit", "Model"));
     bool useNonlinearBoundTightening
         = env->settings->getSetting<bool>("BoundTightening.FeasibilityBased.UseNonlinear", "Model");
 
@@ -1767,6 +1973,10 @@ void Problem::doFBBT()
     int numberOfTightenedVariablesBefore = std::count_if(allVariables.begin(), allVariables.end(),
         [](auto V) { return (V->properties.hasLowerBoundBeenTightened || V->properties.hasUpperBoundBeenTightened); });
 
+    // The term bounds are reused between the passes, and only recalculated when their variable bounds are tightened
+    FBBTVariableBounds.resize(allVariables.size());
+    FBBTTermBoundsCache.resize(numericConstraints.size());
+
     int i = 0;
 
     for(i = 0; i < numberOfIterations; i++)
@@ -1777,14 +1987,13 @@ void Problem::doFBBT()
 
         for(auto& C : linearConstraints)
         {
-            if(env->timing->getElapsedTime("BoundTightening") > timeEnd)
+            if(env->tasks->isCancelled() || env->timing->getElapsedTime("BoundTightening") > timeEnd)
             {
                 stopTightening = true;
                 break;
             }
 
-            boundsUpdated
-                = doFBBTOnConstraint(C, timeEnd - env->timing->getElapsedTime("BoundTightening")) || boundsUpdated;
+            boundsUpdated = doFBBTOnConstraint(C, timeEnd) || boundsUpdated;
         }
 
         if(stopTightening)
@@ -1792,14 +2001,13 @@ void Problem::doFBBT()
 
         for(auto& C : quadraticConstraints)
         {
-            if(env->timing->getElapsedTime("BoundTightening") > timeEnd)
+            if(env->tasks->isCancelled() || env->timing->getElapsedTime("BoundTightening") > timeEnd)
             {
                 stopTightening = true;
                 break;
             }
 
-            boundsUpdated
-                = doFBBTOnConstraint(C, timeEnd - env->timing->getElapsedTime("BoundTightening")) || boundsUpdated;
+            boundsUpdated = doFBBTOnConstraint(C, timeEnd) || boundsUpdated;
         }
 
         if(stopTightening)
@@ -1809,14 +2017,13 @@ void Problem::doFBBT()
         {
             for(auto& C : nonlinearConstraints)
             {
-                if(env->timing->getElapsedTime("BoundTightening") > timeEnd)
+                if(env->tasks->isCancelled() || env->timing->getElapsedTime("BoundTightening") > timeEnd)
                 {
                     stopTightening = true;
                     break;
                 }
 
-                boundsUpdated
-                    = doFBBTOnConstraint(C, timeEnd - env->timing->getElapsedTime("BoundTightening")) || boundsUpdated;
+                boundsUpdated = doFBBTOnConstraint(C, timeEnd) || boundsUpdated;
             }
         }
 
@@ -1824,6 +2031,9 @@ void Problem::doFBBT()
             break;
     }
 
+    FBBTVariableBounds.clear();
+    FBBTTermBoundsCache.clear();
+
     int numberOfTightenedVariablesAfter = std::count_if(allVariables.begin(), allVariables.end(),
         [](auto V) { return (V->properties.hasLowerBoundBeenTightened || V->properties.hasUpperBoundBeenTightened); });
 
@@ -1842,54 +2052,268 @@ void Problem::doFBBT()
             env->timing->getElapsedTime("BoundTighteningFBBTOriginal"), i + 1));
     }
 
+    updateRedundantConstraints();
+
     env->timing->stopTimer("BoundTightening");
 }
 
-bool Problem::doFBBTOnConstraint(NumericConstraintPtr constraint, double timeLimit)
+void Problem::updateRedundantConstraints()
+{
+    auto isRedundant = [](const auto& constraint) {
+        try
+        {
+            auto bounds = constraint->getConstraintFunctionBounds();
+            return (bounds.l() >= constraint->valueLHS && bounds.u() <= constraint->valueRHS);
+        }
+        catch(const mc::Interval::Exceptions&)
+        {
+            return (false);
+        }
+    };
+
+    env->threadPool->parallelFor(
+        numericConstraints.size(),
+        [&](size_t i) { numericConstraints[i]->properties.isRedundant = isRedundant(numericConstraints[i]); }, 50);
+
+    auto updateList = [&](const auto& constraints, auto& nonredundantConstraints) {
+        nonredundantConstraints.clear();
+
+        for(auto& C : constraints)
+        {
+            if(!C->properties.isRedundant)
+                nonredundantConstraints.push_back(C);
+        }
+
+        // At least one constraint is kept so that the maximal constraint value is always defined
+        if(nonredundantConstraints.size() == 0 && constraints.size() > 0)
+            nonredundantConstraints.push_back(constraints[0]);
+    };
+
+    updateList(numericConstraints, nonredundantNumericConstraints);
+    updateList(nonlinearConstraints, nonredundantNonlinearConstraints);
+
+    properties.numberOfRedundantConstraints = (int)std::count_if(numericConstraints.begin(), numericConstraints.end(),
+        [](const auto& C) { return (C->properties.isRedundant); });
+
+    if(properties.numberOfRedundantConstraints > 0)
+    {
+        env->output->outputDebug(fmt::format("  - {} constraints are redundant within the variable bounds.",
+            properties.numberOfRedundantConstraints));
+    }
+}
+
+void Problem::clearRedundantConstraints()
+{
+    if(properties.numberOfRedundantConstraints == 0)
+        return;
+
+    for(auto& C : numericConstraints)
+        C->properties.isRedundant = false;
+
+    nonredundantNumericConstraints = numericConstraints;
+    nonredundantNonlinearConstraints = nonlinearConstraints;
+
+    properties.numberOfRedundantConstraints = 0;
+}
+
+template <typename VersionFunction, typename BoundFunction>
+void Problem::updateFBBTTermBounds(FBBTTermBounds& termBounds, size_t numberOfTerms, VersionFunction getBoundsVersion,
+    BoundFunction calculateBound)
+{
+    if(termBounds.bounds.size() != numberOfTerms)
+    {
+        termBounds.bounds.assign(numberOfTerms, Interval(0.0));
+        termBounds.boundsVersions.assign(numberOfTerms, -1);
+    }
+
+    bool isUpdated = false;
+
+    for(size_t i = 0; i < numberOfTerms; i++)
+    {
+        int boundsVersion = getBoundsVersion(i);
+
+        if(boundsVersion == termBounds.boundsVersions[i])
+            continue;
+
+        termBounds.bounds[i] = calculateBound(i);
+        termBounds.boundsVersions[i] = boundsVersion;
+        isUpdated = true;
+    }
+
+    // Intervals cannot be subtracted without widening them, so the sum is recalculated from the cached bounds
+    if(isUpdated)
+    {
+        termBounds.sum = Interval(0.0);
+
+        for(auto& B : termBounds.bounds)
+            termBounds.sum += B;
+    }
+}
+
+bool Problem::doFBBTOnConstraint(NumericConstraintPtr constraint, double timeEnd)
 {
     bool boundsUpdated = false;
 
-    try
+    // The term bounds are cached during doFBBT(), when all bound changes are made through Variable::tightenBounds
+    bool isCacheTemporary = FBBTTermBoundsCache.empty();
+
+    if(isCacheTemporary)
     {
+        FBBTVariableBounds.resize(allVariables.size());
+        FBBTTermBoundsCache.resize(numericConstraints.size());
+    }
+
+    auto linearConstraint = std::dynamic_pointer_cast<LinearConstraint>(constraint);
+    auto quadraticConstraint = std::dynamic_pointer_cast<QuadraticConstraint>(constraint);
+    auto nonlinearConstraint = std::dynamic_pointer_cast<NonlinearConstraint>(constraint);
+
+    auto& termBounds = FBBTTermBoundsCache[constraint->index];
+
+    auto updateVariableBound
+        = [&](const VariablePtr& variable) { FBBTVariableBounds[variable->index] = variable->getBound(); };
+
+    // Recalculates the bounds of the terms where the bounds of a variable have been tightened since the last time
+    auto updateTermBounds = [&]() {
         if(constraint->properties.hasLinearTerms)
         {
-            Interval otherTermsBound(constraint->constant);
+            auto& terms = linearConstraint->linearTerms;
+
+            updateFBBTTermBounds(
+                termBounds.linearTerms, terms.size(), [&](size_t i) { return (terms[i]->variable->boundsVersion); },
+                [&](size_t i) {
+                    updateVariableBound(terms[i]->variable);
+                    return (terms[i]->calculate(FBBTVariableBounds));
+                });
+        }
+
+        if(constraint->properties.hasQuadraticTerms)
+        {
+            auto& terms = quadraticConstraint->quadraticTerms;
+
+            updateFBBTTermBounds(
+                termBounds.quadraticTerms, terms.size(),
+                [&](size_t i) {
+                    return (terms[i]->firstVariable->boundsVersion + terms[i]->secondVariable->boundsVersion);
+                },
+                [&](size_t i) {
+                    updateVariableBound(terms[i]->firstVariable);
+                    updateVariableBound(terms[i]->secondVariable);
+                    return (terms[i]->calculate(FBBTVariableBounds));
+                });
+        }
+
+        if(constraint->properties.hasMonomialTerms)
+        {
+            auto& terms = nonlinearConstraint->monomialTerms;
 
-            if(constraint->properties.hasQuadraticTerms)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<QuadraticConstraint>(constraint)->quadraticTerms.getBounds();
+            updateFBBTTermBounds(
+                termBounds.monomialTerms, terms.size(),
+                [&](size_t i) {
+                    int boundsVersion = 0;
 
-            if(constraint->properties.hasMonomialTerms)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<NonlinearConstraint>(constraint)->monomialTerms.getBounds();
+                    for(auto& V : terms[i]->variables)
+                        boundsVersion += V->boundsVersion;
 
-            if(constraint->properties.hasSignomialTerms)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<NonlinearConstraint>(constraint)->signomialTerms.getBounds();
+                    return (boundsVersion);
+                },
+                [&](size_t i) {
+                    for(auto& V : terms[i]->variables)
+                        updateVariableBound(V);
 
-            if(constraint->properties.hasNonlinearExpression)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<NonlinearConstraint>(constraint)->nonlinearExpression->getBounds();
+                    return (terms[i]->calculate(FBBTVariableBounds));
+                });
+        }
 
-            auto terms = std::dynamic_pointer_cast<LinearConstraint>(constraint)->linearTerms;
+        if(constraint->properties.hasSignomialTerms)
+        {
+            auto& terms = nonlinearConstraint->signomialTerms;
 
-            for(auto& T : terms)
+            updateFBBTTermBounds(
+                termBounds.signomialTerms, terms.size(),
+                [&](size_t i) {
+                    int boundsVersion = 0;
+
+                    for(auto& E : terms[i]->elements)
+                        boundsVersion += E->variable->boundsVersion;
+
+                    return (boundsVersion);
+                },
+                [&](size_t i) {
+                    for(auto& E : terms[i]->elements)
+                        updateVariableBound(E->variable);
+
+                    return (terms[i]->calculate(FBBTVariableBounds));
+                });
+        }
+
+        if(constraint->properties.hasNonlinearExpression)
+        {
+            updateFBBTTermBounds(
+                termBounds.nonlinearExpression, 1,
+                [&]([[maybe_unused]] size_t i) {
+                    int boundsVersion = 0;
+
+                    for(auto& V : nonlinearConstraint->variablesInNonlinearExpression)
+                        boundsVersion += V->boundsVersion;
+
+                    return (boundsVersion);
+                },
+                [&]([[maybe_unused]] size_t i) { return (nonlinearConstraint->nonlinearExpression->getBounds()); });
+        }
+    };
+
+    // The bound of all terms except the ones of the given type
+    auto getOtherTermsBound = [&](const FBBTTermBounds& excludedTermBounds) {
+        Interval bound(constraint->constant);
+
+        for(auto* B : { &termBounds.linearTerms, &termBounds.quadraticTerms, &termBounds.monomialTerms,
+                 &termBounds.signomialTerms, &termBounds.nonlinearExpression })
+        {
+            if(B != &excludedTermBounds && B->bounds.size() > 0)
+                bound += B->sum;
+        }
+
+        return (bound);
+    };
+
+    // The bounds of the terms before and after each term are formed from prefix and suffix sums, so the bound of the
+    // other terms is obtained in constant time for each term. The suffix sums are not updated when bounds are
+    // tightened during the pass, which is valid since the bounds can only get tighter.
+    auto getSuffixSums = [](const FBBTTermBounds& termBounds) {
+        std::vector<Interval> suffixSums(termBounds.bounds.size() + 1, Interval(0.0));
+
+        for(size_t i = termBounds.bounds.size(); i > 0; i--)
+            suffixSums[i - 1] = suffixSums[i] + termBounds.bounds[i - 1];
+
+        return (suffixSums);
+    };
+
+    try
+    {
+        if(constraint->properties.hasLinearTerms)
+        {
+            updateTermBounds();
+
+            Interval otherTermsBound = getOtherTermsBound(termBounds.linearTerms);
+            auto suffixSums = getSuffixSums(termBounds.linearTerms);
+            Interval prefixSum(0.0);
+
+            auto& terms = linearConstraint->linearTerms;
+
+            for(size_t i = 0; i < terms.size(); i++)
             {
-                if(env->timing->getElapsedTime("BoundTightening") > timeLimit)
+                if(i > 0)
+                    prefixSum += termBounds.linearTerms.bounds[i - 1];
+
+                if(env->tasks->isCancelled())
                     break;
 
+                auto& T = terms[i];
+
                 if(Utilities::isAlmostZero(T->coefficient))
                     continue;
 
-                Interval newBound = otherTermsBound;
-
-                for(auto& T2 : terms)
-                {
-                    if(T2 == T)
-                        continue;
-
-                    newBound += T2->getBounds();
-                }
+                Interval newBound = otherTermsBound + prefixSum + suffixSums[i + 1];
 
                 Interval termBound = Interval(constraint->valueLHS, constraint->valueRHS) - newBound;
 
@@ -1904,44 +2328,30 @@ bool Problem::doFBBTOnConstraint(NumericConstraintPtr constraint, double timeLim
             }
         }
 
-        if(constraint->properties.hasQuadraticTerms && env->timing->getElapsedTime("BoundTightening") < timeLimit)
+        if(constraint->properties.hasQuadraticTerms && env->timing->getElapsedTime("BoundTightening") < timeEnd)
         {
-            Interval otherTermsBound(constraint->constant);
+            updateTermBounds();
 
-            if(constraint->properties.hasLinearTerms)
-                otherTermsBound += std::dynamic_pointer_cast<LinearConstraint>(constraint)->linearTerms.getBounds();
+            Interval otherTermsBound = getOtherTermsBound(termBounds.quadraticTerms);
+            auto suffixSums = getSuffixSums(termBounds.quadraticTerms);
+            Interval prefixSum(0.0);
 
-            if(constraint->properties.hasMonomialTerms)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<NonlinearConstraint>(constraint)->monomialTerms.getBounds();
+            auto& terms = quadraticConstraint->quadraticTerms;
 
-            if(constraint->properties.hasSignomialTerms)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<NonlinearConstraint>(constraint)->signomialTerms.getBounds();
-
-            if(constraint->properties.hasNonlinearExpression)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<NonlinearConstraint>(constraint)->nonlinearExpression->getBounds();
-
-            auto terms = std::dynamic_pointer_cast<QuadraticConstraint>(constraint)->quadraticTerms;
-
-            for(auto& T : terms)
+            for(size_t i = 0; i < terms.size(); i++)
             {
-                if(env->timing->getElapsedTime("BoundTightening") > timeLimit)
+                if(i > 0)
+                    prefixSum += termBounds.quadraticTerms.bounds[i - 1];
+
+                if(env->tasks->isCancelled())
                     break;
 
+                auto& T = terms[i];
+
                 if(Utilities::isAlmostZero(T->coefficient))
                     continue;
 
-                Interval newBound = otherTermsBound;
-
-                for(auto& T2 : terms)
-                {
-                    if(T2 == T)
-                        continue;
-
-                    newBound += T2->getBounds();
-                }
+                Interval newBound = otherTermsBound + prefixSum + suffixSums[i + 1];
 
                 Interval termBound = Interval(constraint->valueLHS, constraint->valueRHS) - newBound;
 
@@ -1983,44 +2393,30 @@ bool Problem::doFBBTOnConstraint(NumericConstraintPtr constraint, double timeLim
             }
         }
 
-        if(constraint->properties.hasMonomialTerms && env->timing->getElapsedTime("BoundTightening") < timeLimit)
+        if(constraint->properties.hasMonomialTerms && env->timing->getElapsedTime("BoundTightening") < timeEnd)
         {
-            Interval otherTermsBound(constraint->constant);
-
-            if(constraint->properties.hasLinearTerms)
-                otherTermsBound += std::dynamic_pointer_cast<LinearConstraint>(constraint)->linearTerms.getBounds();
-
-            if(constraint->properties.hasQuadraticTerms)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<QuadraticConstraint>(constraint)->quadraticTerms.getBounds();
-
-            if(constraint->properties.hasSignomialTerms)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<NonlinearConstraint>(constraint)->signomialTerms.getBounds();
+            updateTermBounds();
 
-            if(constraint->properties.hasNonlinearExpression)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<NonlinearConstraint>(constraint)->nonlinearExpression->getBounds();
+            Interval otherTermsBound = getOtherTermsBound(termBounds.monomialTerms);
+            auto suffixSums = getSuffixSums(termBounds.monomialTerms);
+            Interval prefixSum(0.0);
 
-            auto terms = std::dynamic_pointer_cast<NonlinearConstraint>(constraint)->monomialTerms;
+            auto& terms = nonlinearConstraint->monomialTerms;
 
-            for(auto& T : terms)
+            for(size_t i = 0; i < terms.size(); i++)
             {
-                if(env->timing->getElapsedTime("BoundTightening") > timeLimit)
+                if(i > 0)
+                    prefixSum += termBounds.monomialTerms.bounds[i - 1];
+
+                if(env->tasks->isCancelled())
                     break;
 
+                auto& T = terms[i];
+
                 if(Utilities::isAlmostZero(T->coefficient))
                     continue;
 
-                Interval newBound = otherTermsBound;
-
-                for(auto& T2 : terms)
-                {
-                    if(T2 == T)
-                        continue;
-
-                    newBound += T2->getBounds();
-                }
+                Interval newBound = otherTermsBound + prefixSum + suffixSums[i + 1];
 
                 Interval termBound = Interval(constraint->valueLHS, constraint->valueRHS) - newBound;
                 termBound = termBound / T->coefficient;
@@ -2053,44 +2449,30 @@ bool Problem::doFBBTOnConstraint(NumericConstraintPtr constraint, double timeLim
             }
         }
 
-        if(constraint->properties.hasSignomialTerms && env->timing->getElapsedTime("BoundTightening") < timeLimit)
+        if(constraint->properties.hasSignomialTerms && env->timing->getElapsedTime("BoundTightening") < timeEnd)
         {
-            Interval otherTermsBound(constraint->constant);
-
-            if(constraint->properties.hasLinearTerms)
-                otherTermsBound += std::dynamic_pointer_cast<LinearConstraint>(constraint)->linearTerms.getBounds();
+            updateTermBounds();
 
-            if(constraint->properties.hasQuadraticTerms)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<QuadraticConstraint>(constraint)->quadraticTerms.getBounds();
+            Interval otherTermsBound = getOtherTermsBound(termBounds.signomialTerms);
+            auto suffixSums = getSuffixSums(termBounds.signomialTerms);
+            Interval prefixSum(0.0);
 
-            if(constraint->properties.hasMonomialTerms)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<NonlinearConstraint>(constraint)->monomialTerms.getBounds();
+            auto& terms = nonlinearConstraint->signomialTerms;
 
-            if(constraint->properties.hasNonlinearExpression)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<NonlinearConstraint>(constraint)->nonlinearExpression->getBounds();
-
-            auto terms = std::dynamic_pointer_cast<NonlinearConstraint>(constraint)->signomialTerms;
-
-            for(auto& T : terms)
+            for(size_t i = 0; i < terms.size(); i++)
             {
-                if(env->timing->getElapsedTime("BoundTightening") > timeLimit)
+                if(i > 0)
+                    prefixSum += termBounds.signomialTerms.bounds[i - 1];
+
+                if(env->tasks->isCancelled())
                     break;
 
+                auto& T = terms[i];
+
                 if(Utilities::isAlmostZero(T->coefficient))
                     continue;
 
-                Interval newBound = otherTermsBound;
-
-                for(auto& T2 : terms)
-                {
-                    if(T2 == T)
-                        continue;
-
-                    newBound += T2->getBounds();
-                }
+                Interval newBound = otherTermsBound + prefixSum + suffixSums[i + 1];
 
                 Interval termBound = Interval(constraint->valueLHS, constraint->valueRHS) - newBound;
 
@@ -2124,29 +2506,15 @@ bool Problem::doFBBTOnConstraint(NumericConstraintPtr constraint, double timeLim
             }
         }
 
-        if(constraint->properties.hasNonlinearExpression && env->timing->getElapsedTime("BoundTightening") < timeLimit)
+        if(constraint->properties.hasNonlinearExpression && env->timing->getElapsedTime("BoundTightening") < timeEnd)
         {
-            Interval otherTermsBound(constraint->constant);
-
-            if(constraint->properties.hasLinearTerms)
-                otherTermsBound += std::dynamic_pointer_cast<LinearConstraint>(constraint)->linearTerms.getBounds();
-
-            if(constraint->properties.hasQuadraticTerms)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<QuadraticConstraint>(constraint)->quadraticTerms.getBounds();
-
-            if(constraint->properties.hasMonomialTerms)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<NonlinearConstraint>(constraint)->monomialTerms.getBounds();
+            updateTermBounds();
 
-            if(constraint->properties.hasSignomialTerms)
-                otherTermsBound
-                    += std::dynamic_pointer_cast<NonlinearConstraint>(constraint)->signomialTerms.getBounds();
+            Interval otherTermsBound = getOtherTermsBound(termBounds.nonlinearExpression);
 
             Interval candidate = Interval(constraint->valueLHS, constraint->valueRHS) - otherTermsBound;
 
-            if(std::dynamic_pointer_cast<NonlinearConstraint>(constraint)
-                    ->nonlinearExpression->tightenBounds(candidate))
+            if(nonlinearConstraint->nonlinearExpression->tightenBounds(candidate))
             {
                 env->output->outputDebug(
                     fmt::format("  bound tightened using nonlinear expression in constraint {}.", constraint->name));
@@ -2160,6 +2528,12 @@ bool Problem::doFBBTOnConstraint(NumericConstraintPtr constraint, double timeLim
             fmt::format("  error when tightening bound in constraint {}: {}", constraint->name, e.what()));
     }
 
+    if(isCacheTemporary)
+    {
+        FBBTVariableBounds.clear();
+        FBBTTermBoundsCache.clear();
+    }
+
     // Update variable bounds for original variables also in original problem if tightened in reformulated one
     if(boundsUpdated && this->properties.isReformulated)
     {
@@ -2734,6 +3108,20 @@ ProblemPtr Problem::createCopy(
     return (destinationProblem);
 }
 
+void Problem::updateAuxiliaryVariableProgram()
+{
+    auxiliaryVariableProgram.clear();
+
+    if(!this->properties.isReformulated)
+        return;
+
+    bool negateObjectiveVariable
+        = (this->auxiliaryObjectiveVariable && !this->objectiveFunction->properties.isMinimize);
+
+    auxiliaryVariableProgram.compile(
+        this->auxiliaryVariables, this->auxiliaryObjectiveVariable, negateObjectiveVariable);
+}
+
 void Problem::augmentAuxiliaryVariableValues(VectorDouble& point)
 {
     if(!this->properties.isReformulated)
@@ -2741,27 +3129,15 @@ void Problem::augmentAuxiliaryVariableValues(VectorDouble& point)
 
     assert(point.size() == this->properties.numberOfVariables - this->properties.numberOfAuxiliaryVariables);
 
-    for(auto& V : this->auxiliaryVariables)
-    {
-        double value = V->calculate(point);
-        point.push_back(value); // Need to add the values of the auxiliary variables in case these are needed by
-                                // subsequent aux. variables
-    }
-
-    if(this->auxiliaryObjectiveVariable)
-    {
-        double value = (this->objectiveFunction->properties.isMinimize)
-            ? this->auxiliaryObjectiveVariable->calculate(point)
-            : -1.0 * this->auxiliaryObjectiveVariable->calculate(point);
+    if(!auxiliaryVariableProgram.isCompiled())
+        updateAuxiliaryVariableProgram();
 
-        point.push_back(value);
-    }
+    point.resize(this->properties.numberOfVariables, 0.0);
+    auxiliaryVariableProgram.execute(point);
 
     if(this->antiEpigraphObjectiveVariable)
         point.at(this->antiEpigraphObjectiveVariable->index) = this->objectiveFunction->calculateValue(point);
 
-    assert(point.size() == this->properties.numberOfVariables);
-
 #ifndef NDEBUG
     for(auto& PT : point)
     {
@@ -2771,4 +3147,27 @@ void Problem::augmentAuxiliaryVariableValues(VectorDouble& point)
 
     return;
 }
+
+void Problem::augmentAuxiliaryVariableValues(std::vector<VectorDouble>& points)
+{
+    if(!this->properties.isReformulated)
+        return;
+
+    if(!auxiliaryVariableProgram.isCompiled())
+        updateAuxiliaryVariableProgram();
+
+    for(auto& P : points)
+    {
+        assert(P.size() == this->properties.numberOfVariables - this->properties.numberOfAuxiliaryVariables);
+        P.resize(this->properties.numberOfVariables, 0.0);
+    }
+
+    auxiliaryVariableProgram.execute(points);
+
+    if(this->antiEpigraphObjectiveVariable)
+    {
+        for(auto& P : points)
+            P.at(this->antiEpigraphObjectiveVariable->index) = this->objectiveFunction->calculateValue(P);
+    }
+}
 } // namespace SHOT
\ No newline at end of file
@@ -19,7 +19,9 @@
 #include "ObjectiveFunction.h"
 #include "Constraints.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -72,6 +74,8 @@ struct ProblemProperties
 
     int numberOfAddedLinearizations = 0; // In the initial POA step
 
+    int numberOfRedundantConstraints = 0; // Constraints that cannot be violated within the variable bounds
+
     std::string name = "";
     std::string description = "";
     bool isReformulated = false; // True if this is the reformulated problem
@@ -106,17 +110,68 @@ private:
     bool constraintsUpdated = false;
     bool objectiveUpdated = false;
 
+    std::atomic<bool> factorableFunctionsPrepared = false;
+
+    // CppAD is not set up for parallel mode, so all threads record on the same tape and only one problem is recorded
+    // at a time
+    inline static std::mutex factorableFunctionsRecordingMutex;
+
+    std::recursive_mutex factorableFunctionsMutex;
+
+    // CppAD keeps its memory bookkeeping per thread only in parallel mode, so the functions of different problems can
+    // only be evaluated in parallel if CppAD is not otherwise used by several threads at the same time
+    inline static std::recursive_mutex sharedFactorableFunctionsMutex;
+    inline static std::atomic<bool> isFactorableFunctionsMutexShared = false;
+
     std::shared_ptr<std::vector<std::pair<NumericConstraintPtr, Variables>>> constraintGradientSparsityPattern;
     std::shared_ptr<std::vector<std::pair<VariablePtr, VariablePtr>>> constraintsHessianSparsityPattern;
     std::shared_ptr<std::vector<std::pair<VariablePtr, VariablePtr>>> lagrangianHessianSparsityPattern;
 
     NonlinearConstraints constraintsWithNonlinearExpressions;
 
+    // The numeric constraints each variable appears in, indexed by the variable index. Created on first use.
+    std::vector<std::vector<NumericConstraint*>> variableConstraintIncidence;
+    std::atomic<bool> variableConstraintIncidenceCreated = false;
+    std::mutex variableConstraintIncidenceMutex;
+
+    // The interval bounds of the terms of one type in a constraint, cached during feasibility-based bound tightening.
+    // The bound of a term is only recalculated when the bounds of one of its variables have been tightened.
+    struct FBBTTermBounds
+    {
+        std::vector<Interval> bounds;
+        std::vector<int> boundsVersions;
+        Interval sum = Interval(0.0);
+    };
+
+    struct FBBTConstraintTermBounds
+    {
+        FBBTTermBounds linearTerms;
+        FBBTTermBounds quadraticTerms;
+        FBBTTermBounds monomialTerms;
+        FBBTTermBounds signomialTerms;
+        FBBTTermBounds nonlinearExpression;
+    };
+
+    // Indexed by the variable and constraint indexes, only used during bound tightening
+    IntervalVector FBBTVariableBounds;
+    std::vector<FBBTConstraintTermBounds> FBBTTermBoundsCache;
+
+    template <typename VersionFunction, typename BoundFunction>
+    void updateFBBTTermBounds(FBBTTermBounds& termBounds, size_t numberOfTerms, VersionFunction getBoundsVersion,
+        BoundFunction calculateBound);
+
+    AuxiliaryVariableProgram auxiliaryVariableProgram;
+
     void updateVariableBounds(); // This is called by updateVariables()
     void updateVariables();
     void updateConstraints();
     void updateConvexity();
     void updateFactorableFunctions();
+    void updateAuxiliaryVariableProgram();
+    void updateCompiledExpressions();
+    void updateVariableConstraintIncidence();
+
+    void clearRedundantConstraints(); // Called if the variable bounds are relaxed
 
     bool verifyOwnership();
 
@@ -130,6 +185,10 @@ public:
     ProblemProperties properties;
     std::string name = "";
 
+    // Read from the settings by updateProperties(), since the constraint properties are updated in parallel and the
+    // worker threads should not access the settings, which may log errors
+    double quadraticEigenvalueTolerance = 1e-5;
+
     Variables allVariables;
     Variables realVariables;
     Variables binaryVariables;
@@ -155,17 +214,39 @@ public:
     QuadraticConstraints quadraticConstraints;
     NonlinearConstraints nonlinearConstraints;
 
+    // The constraints that can be violated within the current variable bounds, used when evaluating points. These
+    // contain at least one constraint if the corresponding full list is nonempty.
+    NumericConstraints nonredundantNumericConstraints;
+    NonlinearConstraints nonredundantNonlinearConstraints;
+
     SpecialOrderedSets specialOrderedSets;
 
     std::vector<CppAD::AD<double>> factorableFunctionVariables;
     std::vector<CppAD::AD<double>> factorableFunctions;
     CppAD::ADFun<double> ADFunctions;
 
+    // Evaluating the functions changes the state of the ADFun object, so the functions of a problem are evaluated by
+    // one thread at a time. Returns the lock shared by all problems if shareFactorableFunctionsMutex() has been called.
+    inline std::recursive_mutex& getFactorableFunctionsMutex()
+    {
+        return (isFactorableFunctionsMutexShared ? sharedFactorableFunctionsMutex : factorableFunctionsMutex);
+    }
+
+    // Makes all problems in the process use one lock for the function evaluations, which is needed when functions of
+    // different problems are evaluated in parallel, e.g., when the fixed NLP problems are solved asynchronously. Must
+    // be called before the parallel evaluations start, and is not reverted since the per-problem locks may be held.
+    static inline void shareFactorableFunctionsMutex() { isFactorableFunctionsMutexShared = true; }
+
     void updateProperties();
 
-    // This also updates the problem properties
+    // This also updates the problem properties. Derived data that only some strategies need, e.g., the derivative
+    // tapes and sparsity patterns, is created on first use.
     void finalize();
 
+    // Records the CppAD tape for the nonlinear expressions if this has not been done since the problem was finalized.
+    // Called before the first gradient or Hessian calculation, and can be called from several threads.
+    void prepareFactorableFunctions();
+
     void add(VariablePtr variable);
     void add(Variables variables);
 
@@ -239,6 +320,21 @@ public:
     NumericConstraintValue getMaxNumericConstraintValue(const VectorDouble& point,
         const std::vector<NumericConstraint*>& constraintSelection, std::vector<NumericConstraint*>& activeConstraints);
 
+    // Returns the numeric constraints the variable appears in
+    const std::vector<NumericConstraint*>& getConstraintsWithVariable(int variableIndex);
+
+    // Calculates the values of all numeric constraints in the point, in the same order as numericConstraints
+    NumericConstraintValues getNumericConstraintValues(const VectorDouble& point);
+
+    // Updates the constraint values calculated in a base point to the given point, which only differs from the base
+    // point in the given variables. Only the constraints these variables appear in are recalculated.
+    void updateNumericConstraintValues(const VectorDouble& point, const VectorInteger& changedVariableIndexes,
+        NumericConstraintValues& constraintValues);
+
+    // Calculates the maximal normalized constraint value in several points at once
+    VectorDouble getMaxNumericConstraintValues(
+        const std::vector<VectorDouble>& points, const std::vector<NumericConstraint*>& constraintSelection);
+
     template <typename T>
     NumericConstraintValues getAllDeviatingConstraints(
         const VectorDouble& point, double tolerance, std::vector<T> constraintSelection, double correction = 0.0);
@@ -269,10 +365,14 @@ public:
 
     void saveProblemToFile(std::string filename);
 
+    // Marks the constraints whose function bounds lie within the constraint bounds as redundant
+    void updateRedundantConstraints();
+
     void doFBBT();
-    bool doFBBTOnConstraint(NumericConstraintPtr constraint, double timeLimit);
+    bool doFBBTOnConstraint(NumericConstraintPtr constraint, double timeEnd);
 
     void augmentAuxiliaryVariableValues(VectorDouble& point);
+    void augmentAuxiliaryVariableValues(std::vector<VectorDouble>& points);
 
     friend std::ostream& operator<<(std::ostream& stream, const Problem& problem);
 
@@ -11,6 +11,8 @@
 
 #include "Simplifications.h"
 
+#include "../ThreadPool.h"
+
 #include "spdlog/fmt/fmt.h"
 
 namespace SHOT
@@ -95,20 +97,44 @@ void simplifyNonlinearExpressions(
         }
     }
 
+    // The simplification and term extraction of the constraints are independent of each other and are done in
+    // parallel. Simplify modifies the expression trees, which are not shared between constraints. The results are
+    // stored per constraint and applied afterwards in constraint order, so the problem does not depend on the number
+    // of threads used.
+    using ExtractedTerms
+        = std::tuple<LinearTerms, QuadraticTerms, MonomialTerms, SignomialTerms, NonlinearExpressionPtr, double>;
+
+    std::vector<std::optional<ExtractedTerms>> extractedTerms(problem->numericConstraints.size());
+
+    problem->env->threadPool->parallelFor(
+        problem->numericConstraints.size(),
+        [&](size_t i) {
+            auto& C = problem->numericConstraints[i];
+
+            if(!C->properties.hasNonlinearExpression)
+                return;
+
+            auto nonlinearConstraint = std::dynamic_pointer_cast<NonlinearConstraint>(C);
+            auto nonlinearExpression = simplify(nonlinearConstraint->nonlinearExpression);
+
+            extractedTerms[i] = extractTermsAndConstant(
+                nonlinearExpression, extractMonomials, extractSignomials, extractQuadratics, true);
+        },
+        10);
+
     bool constraintTypesHaveChanged = false;
 
-    for(auto& C : problem->numericConstraints)
+    for(size_t i = 0; i < problem->numericConstraints.size(); i++)
     {
-        if(!C->properties.hasNonlinearExpression)
+        if(!extractedTerms[i])
             continue;
 
+        auto& C = problem->numericConstraints[i];
         auto nonlinearConstraint = std::dynamic_pointer_cast<NonlinearConstraint>(C);
-        auto nonlinearExpression = simplify(nonlinearConstraint->nonlinearExpression);
 
-        auto [tmpLinearTerms, tmpQuadraticTerms, tmpMonomialTerms, tmpSignomialTerms, tmpNonlinearExpression,
+        auto& [tmpLinearTerms, tmpQuadraticTerms, tmpMonomialTerms, tmpSignomialTerms, tmpNonlinearExpression,
             tmpConstant]
-            = extractTermsAndConstant(
-                nonlinearExpression, extractMonomials, extractSignomials, extractQuadratics, true);
+            = *extractedTerms[i];
 
         if(tmpMonomialTerms.size() == 0 && tmpSignomialTerms.size() == 0 && !tmpNonlinearExpression
             && nonlinearConstraint->monomialTerms.size() == 0 && nonlinearConstraint->signomialTerms.size() == 0)
@@ -361,14 +387,16 @@ void simplifyNonlinearExpressions(
         }
     }
 
-    for(auto& C : problem->nonlinearConstraints)
-    {
-        if(C->properties.hasNonlinearExpression)
-        {
-            // Runs again to remove zeroes
-            C->nonlinearExpression = simplify(C->nonlinearExpression);
-        }
-    }
+    // Runs again to remove zeroes
+    problem->env->threadPool->parallelFor(
+        problem->nonlinearConstraints.size(),
+        [&](size_t i) {
+            auto& C = problem->nonlinearConstraints[i];
+
+            if(C->properties.hasNonlinearExpression)
+                C->nonlinearExpression = simplify(C->nonlinearExpression);
+        },
+        10);
 }
 
 NonlinearExpressionPtr copyNonlinearExpression(NonlinearExpression* expression, const ProblemPtr destination)
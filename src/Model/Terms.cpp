@@ -175,17 +175,7 @@ void QuadraticTerms::updateConvexity()
     double eigenvalueTolerance = 0.0;
 
     if(auto sharedOwnerProblem = ownerProblem.lock())
-    {
-        if(sharedOwnerProblem->env->settings)
-        {
-            eigenvalueTolerance = sharedOwnerProblem->env->settings->getSetting<double>(
-                "Convexity.Quadratics.EigenValueTolerance", "Model");
-        }
-        else
-        {
-            eigenvalueTolerance = 1e-5;
-        }
-    }
+        eigenvalueTolerance = sharedOwnerProblem->quadraticEigenvalueTolerance;
 
     for(int i = 0; i < numberOfVariables; i++)
     {
@@ -208,6 +198,90 @@ void QuadraticTerms::updateConvexity()
         minEigenValueWithinTolerance = true;
 }
 
+// The gradient and Hessian of a product coefficient * f_1(x_1) * ... * f_n(x_n) are calculated in one pass over the
+// factors, where the products of all factors but one or two are formed from prefix and suffix products. The cost is
+// thus linear in the number of factors for the gradient, and no divisions by the variable values are needed.
+
+static void addProductGradient(double coefficient, const Variables& variables,
+    const VectorDouble& values, const VectorDouble& firstDerivatives, SparseVariableVector& gradient)
+{
+    size_t numberOfFactors = values.size();
+
+    VectorDouble suffixProducts(numberOfFactors + 1, 1.0);
+
+    for(size_t i = numberOfFactors; i > 0; i--)
+        suffixProducts[i - 1] = suffixProducts[i] * values[i - 1];
+
+    double prefixProduct = coefficient;
+
+    for(size_t i = 0; i < numberOfFactors; i++)
+    {
+        double value = prefixProduct * firstDerivatives[i] * suffixProducts[i + 1];
+
+        auto element = gradient.emplace(variables[i], value);
+
+        if(!element.second)
+        {
+            // Element already exists for the variable
+            element.first->second += value;
+        }
+
+        prefixProduct *= values[i];
+    }
+}
+
+static void addProductHessian(double coefficient, const Variables& variables,
+    const VectorDouble& values, const VectorDouble& firstDerivatives, const VectorDouble& secondDerivatives,
+    SparseVariableMatrix& hessian)
+{
+    size_t numberOfFactors = values.size();
+
+    VectorDouble suffixProducts(numberOfFactors + 1, 1.0);
+
+    for(size_t i = numberOfFactors; i > 0; i--)
+        suffixProducts[i - 1] = suffixProducts[i] * values[i - 1];
+
+    auto addElement = [&](const VariablePtr& firstVariable, const VariablePtr& secondVariable, double value) {
+        auto variablePair = (firstVariable->index <= secondVariable->index)
+            ? std::make_pair(firstVariable, secondVariable)
+            : std::make_pair(secondVariable, firstVariable);
+
+        auto element = hessian.emplace(variablePair, value);
+
+        if(!element.second)
+        {
+            // Element already exists for the variables
+            element.first->second += value;
+        }
+    };
+
+    double prefixProduct = coefficient;
+
+    for(size_t i = 0; i < numberOfFactors; i++)
+    {
+        if(secondDerivatives[i] != 0.0)
+            addElement(variables[i], variables[i], prefixProduct * secondDerivatives[i] * suffixProducts[i + 1]);
+
+        // The product of the factors between the i:th and j:th, including the derivative of the i:th
+        double middleProduct = prefixProduct * firstDerivatives[i];
+
+        for(size_t j = i + 1; j < numberOfFactors; j++)
+        {
+            double value = middleProduct * firstDerivatives[j] * suffixProducts[j + 1];
+
+            // Both mixed derivatives end up on the diagonal if the factors have the same variable
+            if(variables[i] == variables[j])
+                value *= 2.0;
+
+            addElement(variables[i], variables[j], value);
+
+            middleProduct *= values[j];
+        }
+
+        prefixProduct *= values[i];
+    }
+}
+
 MonomialTerm::MonomialTerm(const MonomialTerm* term, ProblemPtr destinationProblem)
 {
     this->coefficient = term->coefficient;
@@ -221,6 +295,95 @@ MonomialTerm::MonomialTerm(const MonomialTerm* term, ProblemPtr destinationProbl
     }
 }
 
+void MonomialTerm::calculateGradient(const VectorDouble& point, SparseVariableVector& gradient) const
+{
+    VectorDouble values(variables.size());
+    VectorDouble firstDerivatives(variables.size(), 1.0);
+
+    for(size_t i = 0; i < variables.size(); i++)
+        values[i] = variables[i]->calculate(point);
+
+    addProductGradient(coefficient, variables, values, firstDerivatives, gradient);
+}
+
+void MonomialTerm::calculateHessian(const VectorDouble& point, SparseVariableMatrix& hessian) const
+{
+    VectorDouble values(variables.size());
+    VectorDouble firstDerivatives(variables.size(), 1.0);
+    VectorDouble secondDerivatives(variables.size(), 0.0);
+
+    for(size_t i = 0; i < variables.size(); i++)
+        values[i] = variables[i]->calculate(point);
+
+    addProductHessian(coefficient, variables, values, firstDerivatives, secondDerivatives, hessian);
+}
+
+void SignomialElement::calculateDerivatives(
+    const VectorDouble& point, double& value, double& firstDerivative, double& secondDerivative) const
+{
+    double variableValue = variable->calculate(point);
+
+    if(power == 1.0)
+    {
+        value = variableValue;
+        firstDerivative = 1.0;
+        secondDerivative = 0.0;
+    }
+    else if(power == 2.0)
+    {
+        value = variableValue * variableValue;
+        firstDerivative = 2.0 * variableValue;
+        secondDerivative = 2.0;
+    }
+    else if(variableValue != 0.0)
+    {
+        // The derivatives reuse the power already calculated
+        value = pow(variableValue, power);
+        firstDerivative = power * value / variableValue;
+        secondDerivative = (power - 1.0) * firstDerivative / variableValue;
+    }
+    else
+    {
+        value = pow(variableValue, power);
+        firstDerivative = power * pow(variableValue, power - 1.0);
+        secondDerivative = power * (power - 1.0) * pow(variableValue, power - 2.0);
+    }
+}
+
+void SignomialTerm::calculateGradient(const VectorDouble& point, SparseVariableVector& gradient) const
+{
+    Variables variables;
+    variables.resize(elements.size());
+    VectorDouble values(elements.size());
+    VectorDouble firstDerivatives(elements.size());
+    double secondDerivative;
+
+    for(size_t i = 0; i < elements.size(); i++)
+    {
+        variables[i] = elements[i]->variable;
+        elements[i]->calculateDerivatives(point, values[i], firstDerivatives[i], secondDerivative);
+    }
+
+    addProductGradient(coefficient, variables, values, firstDerivatives, gradient);
+}
+
+void SignomialTerm::calculateHessian(const VectorDouble& point, SparseVariableMatrix& hessian) const
+{
+    Variables variables;
+    variables.resize(elements.size());
+    VectorDouble values(elements.size());
+    VectorDouble firstDerivatives(elements.size());
+    VectorDouble secondDerivatives(elements.size());
+
+    for(size_t i = 0; i < elements.size(); i++)
+    {
+        variables[i] = elements[i]->variable;
+        elements[i]->calculateDerivatives(point, values[i], firstDerivatives[i], secondDerivatives[i]);
+    }
+
+    addProductHessian(coefficient, variables, values, firstDerivatives, secondDerivatives, hessian);
+}
+
 SignomialTerm::SignomialTerm(const SignomialTerm* term, ProblemPtr destinationProblem)
 {
     this->coefficient = term->coefficient;
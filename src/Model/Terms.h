@@ -19,6 +19,7 @@
 #include "ffunc.hpp"
 
 #include <Eigen/Eigenvalues>
+#include <atomic>
 #include <vector>
 
 namespace SHOT
@@ -125,6 +126,13 @@ protected:
 
     std::weak_ptr<Problem> ownerProblem;
 
+    // Changed whenever terms are added or removed through the container. The values are unique over all containers,
+    // so that data derived from the terms, e.g., in the objective function, can be checked for changes.
+    size_t version = 0;
+    inline static std::atomic<size_t> versionCounter = 0;
+
+    inline void updateVersion() { version = ++versionCounter; }
+
     virtual void updateConvexity() = 0;
 
     void updateMonotonicity()
@@ -140,14 +148,44 @@ public:
 
     using std::vector<T>::at;
     using std::vector<T>::begin;
-    using std::vector<T>::clear;
     using std::vector<T>::end;
-    using std::vector<T>::erase;
-    using std::vector<T>::push_back;
     using std::vector<T>::reserve;
-    using std::vector<T>::resize;
     using std::vector<T>::size;
 
+    // The coefficients of the terms can still be changed without changing the version
+    inline size_t getVersion() const { return (version); }
+
+    inline void clear()
+    {
+        std::vector<T>::clear();
+        updateVersion();
+    }
+
+    inline typename std::vector<T>::iterator erase(typename std::vector<T>::const_iterator position)
+    {
+        updateVersion();
+        return (std::vector<T>::erase(position));
+    }
+
+    inline typename std::vector<T>::iterator erase(
+        typename std::vector<T>::const_iterator first, typename std::vector<T>::const_iterator last)
+    {
+        updateVersion();
+        return (std::vector<T>::erase(first, last));
+    }
+
+    inline void push_back(const T& term)
+    {
+        std::vector<T>::push_back(term);
+        updateVersion();
+    }
+
+    inline void resize(size_t count)
+    {
+        std::vector<T>::resize(count);
+        updateVersion();
+    }
+
     Terms() = default;
     Terms(std::initializer_list<T> terms)
     {
@@ -237,12 +275,12 @@ public:
 
     using std::vector<LinearTermPtr>::at;
     using std::vector<LinearTermPtr>::begin;
-    using std::vector<LinearTermPtr>::clear;
+    using Terms<LinearTermPtr>::clear;
     using std::vector<LinearTermPtr>::end;
-    using std::vector<LinearTermPtr>::erase;
-    using std::vector<LinearTermPtr>::push_back;
+    using Terms<LinearTermPtr>::erase;
+    using Terms<LinearTermPtr>::push_back;
     using std::vector<LinearTermPtr>::reserve;
-    using std::vector<LinearTermPtr>::resize;
+    using Terms<LinearTermPtr>::resize;
     using std::vector<LinearTermPtr>::size;
 
     LinearTerms() = default;
@@ -256,9 +294,14 @@ public:
             [&variable](const LinearTermPtr& ptr) { return ptr->variable == variable; });
 
         if(it != (*this).end())
+        {
             it->get()->coefficient += term->coefficient;
+            updateVersion();
+        }
         else
+        {
             (*this).push_back(term);
+        }
 
         monotonicity = E_Monotonicity::NotSet;
     }
@@ -446,12 +489,12 @@ public:
 
     using std::vector<QuadraticTermPtr>::at;
     using std::vector<QuadraticTermPtr>::begin;
-    using std::vector<QuadraticTermPtr>::clear;
+    using Terms<QuadraticTermPtr>::clear;
     using std::vector<QuadraticTermPtr>::end;
-    using std::vector<QuadraticTermPtr>::erase;
-    using std::vector<QuadraticTermPtr>::push_back;
+    using Terms<QuadraticTermPtr>::erase;
+    using Terms<QuadraticTermPtr>::push_back;
     using std::vector<QuadraticTermPtr>::reserve;
-    using std::vector<QuadraticTermPtr>::resize;
+    using Terms<QuadraticTermPtr>::resize;
     using std::vector<QuadraticTermPtr>::size;
 
     QuadraticTerms() = default;
@@ -471,6 +514,7 @@ public:
         if(it != (*this).end())
         {
             it->get()->coefficient += term->coefficient;
+            updateVersion();
         }
         else
         {
@@ -604,6 +648,12 @@ public:
         return value;
     }
 
+    // Adds the gradient of the term to the given sparse gradient
+    void calculateGradient(const VectorDouble& point, SparseVariableVector& gradient) const;
+
+    // Adds the upper triangular part of the Hessian of the term to the given sparse Hessian
+    void calculateHessian(const VectorDouble& point, SparseVariableMatrix& hessian) const;
+
     inline E_Convexity getConvexity() const override { return E_Convexity::Nonconvex; };
 
     inline E_Monotonicity getMonotonicity() const override { return E_Monotonicity::Unknown; };
@@ -660,12 +710,12 @@ public:
 
     using std::vector<MonomialTermPtr>::at;
     using std::vector<MonomialTermPtr>::begin;
-    using std::vector<MonomialTermPtr>::clear;
+    using Terms<MonomialTermPtr>::clear;
     using std::vector<MonomialTermPtr>::end;
-    using std::vector<MonomialTermPtr>::erase;
-    using std::vector<MonomialTermPtr>::push_back;
+    using Terms<MonomialTermPtr>::erase;
+    using Terms<MonomialTermPtr>::push_back;
     using std::vector<MonomialTermPtr>::reserve;
-    using std::vector<MonomialTermPtr>::resize;
+    using Terms<MonomialTermPtr>::resize;
     using std::vector<MonomialTermPtr>::size;
 
     MonomialTerms() = default;
@@ -691,72 +741,38 @@ public:
         }
     }
 
-    SparseVariableVector calculateGradient(const VectorDouble& point) const
+    // Adds the gradient of the terms to the given sparse gradient
+    void calculateGradient(const VectorDouble& point, SparseVariableVector& gradient) const
     {
-        SparseVariableVector gradient;
-
         for(auto& T : (*this))
         {
-            if(T->coefficient == 0.0)
-                continue;
-
-            for(auto& V1 : T->variables)
-            {
-                double value = 1.0;
-
-                for(auto& V2 : T->variables)
-                {
-                    if(V1 == V2)
-                        continue;
-
-                    value *= V2->calculate(point);
-                }
+            if(T->coefficient != 0.0)
+                T->calculateGradient(point, gradient);
+        }
+    };
 
-                gradient.emplace(V1, value);
-            }
-        };
+    SparseVariableVector calculateGradient(const VectorDouble& point) const
+    {
+        SparseVariableVector gradient;
+        calculateGradient(point, gradient);
 
         return gradient;
     };
 
-    SparseVariableMatrix calculateHessian(const VectorDouble& point) const
+    // Adds the upper triangular part of the Hessian of the terms to the given sparse Hessian
+    void calculateHessian(const VectorDouble& point, SparseVariableMatrix& hessian) const
     {
-        SparseVariableMatrix hessian;
-
         for(auto& T : (*this))
         {
-            if(T->coefficient == 0)
-                continue;
-
-            for(auto& V1 : T->variables)
-            {
-                for(auto& V2 : T->variables)
-                {
-                    if(V1->index >= V2->index)
-                        continue;
-
-                    double value = T->coefficient;
-
-                    for(auto& V3 : T->variables)
-                    {
-                        if(V3 == V1 || V3 == V2)
-                            continue;
-
-                        value *= V3->calculate(point);
-                    }
-
-                    std::pair<VariablePtr, VariablePtr> variablePair = std::make_pair(V1, V2);
-
-                    auto element = hessian.emplace(variablePair, value);
-
-                    if(!element.second)
-                    {
-                        // Element already exists for the variable
-                        element.first->second += value;
-                    }
-                }
-            }
+            if(T->coefficient != 0.0)
+                T->calculateHessian(point, hessian);
         }
+    };
+
+    SparseVariableMatrix calculateHessian(const VectorDouble& point) const
+    {
+        SparseVariableMatrix hessian;
+        calculateHessian(point, hessian);
 
         return hessian;
     };
@@ -771,7 +787,22 @@ public:
 
     SignomialElement(VariablePtr variable, double power) : variable(variable), power(power) {};
 
-    inline double calculate(const VectorDouble& point) const { return pow(variable->calculate(point), power); }
+    inline double calculate(const VectorDouble& point) const
+    {
+        double value = variable->calculate(point);
+
+        if(power == 1.0)
+            return (value);
+
+        if(power == 2.0)
+            return (value * value);
+
+        return pow(value, power);
+    }
+
+    // Calculates the value and the first and second derivatives of the element w.r.t. its variable
+    void calculateDerivatives(
+        const VectorDouble& point, double& value, double& firstDerivative, double& secondDerivative) const;
 
     inline Interval calculate(const IntervalVector& intervalVector) const
     {
@@ -957,6 +988,12 @@ public:
         return value;
     }
 
+    // Adds the gradient of the term to the given sparse gradient
+    void calculateGradient(const VectorDouble& point, SparseVariableVector& gradient) const;
+
+    // Adds the upper triangular part of the Hessian of the term to the given sparse Hessian
+    void calculateHessian(const VectorDouble& point, SparseVariableMatrix& hessian) const;
+
     inline E_Convexity getConvexity() const override
     {
         size_t numberPositivePowers = 0;
@@ -1119,12 +1156,12 @@ public:
 
     using std::vector<SignomialTermPtr>::at;
     using std::vector<SignomialTermPtr>::begin;
-    using std::vector<SignomialTermPtr>::clear;
+    using Terms<SignomialTermPtr>::clear;
     using std::vector<SignomialTermPtr>::end;
-    using std::vector<SignomialTermPtr>::erase;
-    using std::vector<SignomialTermPtr>::push_back;
+    using Terms<SignomialTermPtr>::erase;
+    using Terms<SignomialTermPtr>::push_back;
     using std::vector<SignomialTermPtr>::reserve;
-    using std::vector<SignomialTermPtr>::resize;
+    using Terms<SignomialTermPtr>::resize;
     using std::vector<SignomialTermPtr>::size;
 
     SignomialTerms() = default;
@@ -1150,88 +1187,38 @@ public:
         }
     }
 
-    inline SparseVariableVector calculateGradient(const VectorDouble& point) const
+    // Adds the gradient of the terms to the given sparse gradient
+    void calculateGradient(const VectorDouble& point, SparseVariableVector& gradient) const
     {
-        SparseVariableVector gradient;
-
         for(auto& T : (*this))
         {
-            if(T->coefficient == 0.0)
-                continue;
-
-            for(auto& E1 : T->elements)
-            {
-                double value = 1.0;
-
-                for(auto& E2 : T->elements)
-                {
-                    if(E1 == E2)
-                    {
-                        if(E2->power != 1.0)
-                            value *= E2->power * pow(E2->variable->calculate(point), E2->power - 1.0);
-                    }
-                    else
-                    {
-                        value *= E2->calculate(point);
-                    }
-                }
-
-                auto element = gradient.emplace(E1->variable, T->coefficient * value);
+            if(T->coefficient != 0.0)
+                T->calculateGradient(point, gradient);
+        }
+    };
 
-                if(!element.second)
-                {
-                    // Element already exists for the variable
-                    element.first->second += value;
-                }
-            }
-        };
+    SparseVariableVector calculateGradient(const VectorDouble& point) const
+    {
+        SparseVariableVector gradient;
+        calculateGradient(point, gradient);
 
         return gradient;
     };
 
-    SparseVariableMatrix calculateHessian(const VectorDouble& point) const
+    // Adds the upper triangular part of the Hessian of the terms to the given sparse Hessian
+    void calculateHessian(const VectorDouble& point, SparseVariableMatrix& hessian) const
     {
-        SparseVariableMatrix hessian;
-
         for(auto& T : (*this))
         {
-            if(T->coefficient == 0)
-                continue;
-
-            auto value = T->calculate(point);
-
-            for(auto& E1 : T->elements)
-            {
-                for(auto& E2 : T->elements)
-                {
-                    if(E1->variable->index > E2->variable->index)
-                        continue;
-
-                    double corrFactor;
-
-                    if(E1->variable->index == E2->variable->index)
-                    {
-                        corrFactor = E1->power * (E1->power - 1.0)
-                            / (E1->variable->calculate(point) * E1->variable->calculate(point));
-                    }
-                    else
-                    {
-                        corrFactor
-                            = E1->power * E2->power / (E1->variable->calculate(point) * E2->variable->calculate(point));
-                    }
-
-                    auto variablePair = std::make_pair(E1->variable, E2->variable);
-
-                    auto element = hessian.emplace(variablePair, corrFactor * value);
-
-                    if(!element.second)
-                    {
-                        // Element already exists for the variable
-                        element.first->second += corrFactor * value;
-                    }
-                }
-            }
+            if(T->coefficient != 0.0)
+                T->calculateHessian(point, hessian);
         }
+    };
+
+    SparseVariableMatrix calculateHessian(const VectorDouble& point) const
+    {
+        SparseVariableMatrix hessian;
+        calculateHessian(point, hessian);
 
         return hessian;
     };
@@ -78,6 +78,8 @@ bool Variable::tightenBounds(const Interval bound)
 
     if(tightened)
     {
+        boundsVersion++;
+
         if(auto sharedOwnerProblem = ownerProblem.lock())
         {
             if(sharedOwnerProblem->env->output)
@@ -72,6 +72,8 @@ public:
     double lowerBound;
     double semiBound;
 
+    int boundsVersion = 0; // Increased each time the bounds are tightened
+
     FactorableFunction* factorableFunctionVariable;
 
     Variable()
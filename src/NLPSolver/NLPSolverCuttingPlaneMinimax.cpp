@@ -13,6 +13,7 @@
 #include "../Output.h"
 #include "../Report.h"
 #include "../Settings.h"
+#include "../TaskHandler.h"
 #include "../Timing.h"
 #include "../Utilities.h"
 #include "../DualSolver.h"
@@ -359,8 +360,9 @@ E_NLPSolutionStatus NLPSolverCuttingPlaneMinimax::solveProblemInstance()
             break;
         }
 
-        if(env->timing->getElapsedTime("InteriorPointSearch")
-            > env->settings->getSetting<double>("ESH.InteriorPoint.CuttingPlane.TimeLimit", "Dual"))
+        if(env->tasks->isCancelled()
+            || env->timing->getElapsedTime("InteriorPointSearch")
+                > env->settings->getSetting<double>("ESH.InteriorPoint.CuttingPlane.TimeLimit", "Dual"))
         {
             statusCode = E_NLPSolutionStatus::TimeLimit;
             break;
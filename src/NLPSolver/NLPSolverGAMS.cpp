@@ -12,6 +12,7 @@
 
 #include "../Output.h"
 #include "../Settings.h"
+#include "../TaskHandler.h"
 
 #include <cstdio>
 #include <cstring>
@@ -205,8 +206,11 @@ E_NLPSolutionStatus NLPSolverGAMS::solveProblemInstance()
     if(showlog)
         gevSwitchLogStat(modelingEnvironment, 3, nullptr, 0, nullptr, 0, gevwritecallback, &cbdata, &cbdata.orighandle);
 
+    // The NLP solver may not run past the time limit of the solver
+    double solveTimeLimit = std::min(timelimit, env->tasks->getRemainingTime());
+
     if(gevCallSolver(modelingEnvironment, modelingObject, "", nlpsolver.c_str(), gevSolveLinkLoadLibrary,
-           showlog ? gevSolverSameStreams : gevSolverQuiet, nullptr, nullptr, timelimit, iterlimit, 0, 0.0, 0.0,
+           showlog ? gevSolverSameStreams : gevSolverQuiet, nullptr, nullptr, solveTimeLimit, iterlimit, 0, 0.0, 0.0,
            nullptr, msg)
         != 0)
     {
@@ -14,6 +14,7 @@
 
 #include "../Output.h"
 #include "../Settings.h"
+#include "../TaskHandler.h"
 #include "../Utilities.h"
 
 namespace SHOT
@@ -489,6 +490,15 @@ bool IpoptProblem::get_scaling_parameters(Number& obj_scaling, [[maybe_unused]]
     return (true);
 }
 
+bool IpoptProblem::intermediate_callback([[maybe_unused]] AlgorithmMode mode, [[maybe_unused]] Index iter,
+    [[maybe_unused]] Number obj_value, [[maybe_unused]] Number inf_pr, [[maybe_unused]] Number inf_du,
+    [[maybe_unused]] Number mu, [[maybe_unused]] Number d_norm, [[maybe_unused]] Number regularization_size,
+    [[maybe_unused]] Number alpha_du, [[maybe_unused]] Number alpha_pr, [[maybe_unused]] Index ls_trials,
+    [[maybe_unused]] const IpoptData* ip_data, [[maybe_unused]] IpoptCalculatedQuantities* ip_cq)
+{
+    return (!env->tasks->isCancelled());
+}
+
 void IpoptProblem::finalize_solution(SolverReturn status, [[maybe_unused]] Index n, const Number* x,
     [[maybe_unused]] const Number* z_L, [[maybe_unused]] const Number* z_U, [[maybe_unused]] Index m,
     [[maybe_unused]] const Number* g, [[maybe_unused]] const Number* lambda, Number obj_value,
@@ -576,9 +586,9 @@ void IpoptProblem::finalize_solution(SolverReturn status, [[maybe_unused]] Index
         break;
 
     case USER_REQUESTED_STOP:
-        solutionDescription = "The user requested a premature termination of the optimization.";
+        solutionDescription = "Terminated since the solver was terminated or reached its time limit.";
 
-        solutionStatus = E_NLPSolutionStatus::Error;
+        solutionStatus = E_NLPSolutionStatus::TimeLimit;
 
         if(x != nullptr)
         {
@@ -702,6 +712,12 @@ E_NLPSolutionStatus NLPSolverIpoptBase::solveProblemInstance()
     {
         Ipopt::ApplicationReturnStatus ipoptStatus;
 
+        // Ipopt may not run past the time limit of the solver
+        ipoptApplication->Options()->SetNumericValue("max_cpu_time",
+            std::max(0.001,
+                std::min(env->settings->getSetting<double>("FixedInteger.TimeLimit", "Primal"),
+                    env->tasks->getRemainingTime())));
+
         if(!hasBeenSolved)
         {
             ipoptStatus = ipoptApplication->OptimizeTNLP(ipoptProblem);
@@ -740,6 +756,11 @@ E_NLPSolutionStatus NLPSolverIpoptBase::solveProblemInstance()
             env->output->outputDebug("        No solution found to problem with Ipopt: Time limit exceeded.");
             break;
 
+        case Ipopt::ApplicationReturnStatus::User_Requested_Stop:
+            status = E_NLPSolutionStatus::TimeLimit;
+            env->output->outputDebug("        No solution found to problem with Ipopt: Solver terminated.");
+            break;
+
         case Ipopt::ApplicationReturnStatus::Diverging_Iterates:
             status = E_NLPSolutionStatus::Unbounded;
             env->output->outputDebug("        No solution found to problem with Ipopt: Diverging iterates.");
@@ -18,6 +18,9 @@
 #include "../Results.h"
 #include "../Settings.h"
 #include "../Solver.h"
+#include "../TaskHandler.h"
+#include "../ThreadPool.h"
+#include "../Timing.h"
 #include "../MIPSolver/IMIPSolver.h"
 #include "../Model/ObjectiveFunction.h"
 #include "../Model/Problem.h"
@@ -47,6 +50,9 @@ void NLPSolverSHOT::initializeMIPProblem()
 {
     solver = std::make_shared<Solver>();
 
+    // The subsolver uses the threads of the main solver instead of starting its own
+    solver->getEnvironment()->threadPool = env->threadPool;
+
     solver->getEnvironment()->output->setPrefix("      | ");
 
     if(env->settings->getSetting<bool>("Console.PrimalSolver.Show", "Output"))
@@ -81,8 +87,8 @@ void NLPSolverSHOT::initializeMIPProblem()
     solver->updateSetting(
         "ConstraintTolerance", "Termination", env->settings->getSetting<double>("ConstraintTolerance", "Termination"));
 
-    solver->updateSetting(
-        "TimeLimit", "Termination", env->settings->getSetting<double>("FixedInteger.TimeLimit", "Primal"));
+    timeLimit = env->settings->getSetting<double>("FixedInteger.TimeLimit", "Primal");
+
     solver->updateSetting(
         "IterationLimit", "Termination", env->settings->getSetting<int>("FixedInteger.IterationLimit", "Primal"));
 
@@ -185,6 +191,12 @@ E_NLPSolutionStatus NLPSolverSHOT::solveProblemInstance()
 
     solver->getEnvironment()->output->outputInfo("");
 
+    // The time limit of the subsolver is measured from its creation, so the time it has already used is added. The main
+    // solver's time limit is respected as well.
+    solver->updateSetting("TimeLimit", "Termination",
+        solver->getEnvironment()->timing->getElapsedTime("Total")
+            + std::min(timeLimit, env->tasks->getRemainingTime()));
+
     // Set fixed discrete variables
     for(size_t i = 0; i < fixedVariableIndexes.size(); ++i)
         relaxedProblem->setVariableBounds(fixedVariableIndexes[i], fixedVariableValues[i], fixedVariableValues[i]);
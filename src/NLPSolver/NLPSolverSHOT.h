@@ -56,6 +56,9 @@ public:
 
     std::shared_ptr<Solver> solver;
 
+    // The time limit (s) for each solve
+    double timeLimit = SHOT_DBL_MAX;
+
 protected:
     E_NLPSolutionStatus solveProblemInstance() override;
 
@@ -24,7 +24,7 @@ Output::Output()
     SetConsoleOutputCP(CP_UTF8); // For correct output of special characters on Windows
 #endif
 
-    consoleSink = std::make_shared<spdlog::sinks::stdout_sink_st>();
+    consoleSink = std::make_shared<spdlog::sinks::stdout_sink_mt>();
     std::vector<spdlog::sink_ptr> sinks { consoleSink };
     logger = std::make_shared<spdlog::logger>("multi_sink", sinks.begin(), sinks.end());
 
@@ -159,7 +159,7 @@ void Output::setConsoleSink(std::shared_ptr<spdlog::sinks::sink> newSink)
 
 void Output::setFileSink(std::string filename)
 {
-    fileSink = std::make_shared<spdlog::sinks::basic_file_sink_st>(filename, true);
+    fileSink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(filename, true);
     fileSink->set_pattern("%v");
     fileSink->set_level(consoleSink->level());
 
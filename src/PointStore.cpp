@@ -0,0 +1,68 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "PointStore.h"
+
+#include "Utilities.h"
+
+namespace SHOT
+{
+
+PointHandle PointStore::add(const VectorDouble& point) { return (add(point, PointHandle())); }
+
+PointHandle PointStore::add(const PointHandle& point) { return (add(point.get(), point)); }
+
+PointHandle PointStore::add(const VectorDouble& point, const PointHandle& handle)
+{
+    std::lock_guard<std::mutex> lock(pointsMutex);
+
+    double hash = Utilities::calculateHash(point);
+    auto range = points.equal_range(hash);
+
+    for(auto it = range.first; it != range.second; ++it)
+    {
+        auto storedPoint = it->second.lock();
+
+        if(storedPoint && *storedPoint == point)
+            return (PointHandle(storedPoint));
+    }
+
+    // The given handle is reused so that the point is not copied
+    auto storedHandle = handle.point ? handle : PointHandle(point);
+    points.emplace(hash, storedHandle.point);
+
+    if(points.size() > 2 * sizeAfterLastCleanup + 1000)
+        removeUnusedPoints();
+
+    return (storedHandle);
+}
+
+size_t PointStore::size()
+{
+    std::lock_guard<std::mutex> lock(pointsMutex);
+
+    removeUnusedPoints();
+    return (points.size());
+}
+
+void PointStore::removeUnusedPoints()
+{
+    for(auto it = points.begin(); it != points.end();)
+    {
+        if(it->second.expired())
+            it = points.erase(it);
+        else
+            ++it;
+    }
+
+    sizeAfterLastCleanup = points.size();
+}
+
+} // namespace SHOT
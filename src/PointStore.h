@@ -0,0 +1,49 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+#include "Environment.h"
+#include "Structs.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace SHOT
+{
+
+// Keeps one copy of each distinct point that is in use, e.g., the points hyperplanes are generated in. A point is
+// released when the last handle to it is removed.
+class PointStore
+{
+public:
+    inline PointStore(EnvironmentPtr envPtr) { env = envPtr; };
+    inline ~PointStore() { points.clear(); }
+
+    // Returns a handle to a stored point equal to the given one, or stores it if there is none
+    PointHandle add(const VectorDouble& point);
+    PointHandle add(const PointHandle& point);
+
+    // The number of distinct points still in use
+    size_t size();
+
+private:
+    EnvironmentPtr env;
+
+    std::unordered_multimap<double, std::weak_ptr<const VectorDouble>> points;
+    size_t sizeAfterLastCleanup = 0;
+
+    std::mutex pointsMutex;
+
+    PointHandle add(const VectorDouble& point, const PointHandle& handle);
+    void removeUnusedPoints();
+};
+
+} // namespace SHOT
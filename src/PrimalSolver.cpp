@@ -29,6 +29,7 @@ void PrimalSolver::addPrimalSolutionCandidate(VectorDouble pt, E_PrimalSolutionS
     sol.point = pt;
     sol.sourceType = source;
     sol.objValue = env->problem->objectiveFunction->calculateValue(pt);
+    sol.isObjectiveValueExact = true;
     sol.iterFound = iter;
 
     if(env->problem->properties.numberOfNonlinearConstraints > 0)
@@ -44,6 +45,8 @@ void PrimalSolver::addPrimalSolutionCandidate(VectorDouble pt, E_PrimalSolutionS
         sol.maxDevatingConstraintLinear = PairIndexValue(maxDevLinear.constraint->index, maxDevLinear.normalizedValue);
     }
 
+    std::lock_guard<std::recursive_mutex> lock(primalSolutionMutex);
+
     env->primalSolver->primalSolutionCandidates.push_back(sol);
 
     this->checkPrimalSolutionCandidates();
@@ -66,6 +69,8 @@ void PrimalSolver::addPrimalSolutionCandidate(SolutionPoint pt, E_PrimalSolution
     sol.objValue = pt.objectiveValue;
     sol.iterFound = pt.iterFound;
 
+    std::lock_guard<std::recursive_mutex> lock(primalSolutionMutex);
+
     env->primalSolver->primalSolutionCandidates.push_back(sol);
 
     this->checkPrimalSolutionCandidates();
@@ -81,6 +86,8 @@ void PrimalSolver::addPrimalSolutionCandidates(std::vector<SolutionPoint> pts, E
 
 void PrimalSolver::checkPrimalSolutionCandidates()
 {
+    std::lock_guard<std::recursive_mutex> lock(primalSolutionMutex);
+
     env->timing->startTimer("PrimalStrategy");
 
     for(auto& cand : env->primalSolver->primalSolutionCandidates)
@@ -93,6 +100,54 @@ void PrimalSolver::checkPrimalSolutionCandidates()
     env->timing->stopTimer("PrimalStrategy");
 }
 
+template <typename T>
+static NumericConstraintValue getMaxNumericConstraintValue(
+    const NumericConstraintValues& constraintValues, const std::vector<std::shared_ptr<T>>& constraintSelection)
+{
+    assert(constraintSelection.size() > 0);
+
+    auto value = constraintValues[constraintSelection[0]->index];
+
+    for(size_t i = 1; i < constraintSelection.size(); i++)
+    {
+        auto& tmpValue = constraintValues[constraintSelection[i]->index];
+
+        if(tmpValue.normalizedValue > value.normalizedValue)
+            value = tmpValue;
+    }
+
+    return value;
+}
+
+const NumericConstraintValues& PrimalSolver::getNumericConstraintValues(const VectorDouble& point)
+{
+    if(previousCheckedPoint.size() == point.size()
+        && previousConstraintValues.size() == env->problem->numericConstraints.size())
+    {
+        VectorInteger changedVariableIndexes;
+
+        for(size_t i = 0; i < point.size(); i++)
+        {
+            if(point[i] != previousCheckedPoint[i])
+                changedVariableIndexes.push_back(i);
+        }
+
+        // Recalculating all constraints is cheaper if most of the variables have changed
+        if(2 * changedVariableIndexes.size() < point.size())
+        {
+            env->problem->updateNumericConstraintValues(point, changedVariableIndexes, previousConstraintValues);
+            previousCheckedPoint = point;
+
+            return (previousConstraintValues);
+        }
+    }
+
+    previousConstraintValues = env->problem->getNumericConstraintValues(point);
+    previousCheckedPoint = point;
+
+    return (previousConstraintValues);
+}
+
 bool PrimalSolver::checkPrimalSolutionPoint(PrimalSolution primalSol)
 {
     std::string sourceDesc;
@@ -127,6 +182,9 @@ bool PrimalSolver::checkPrimalSolutionPoint(PrimalSolution primalSol)
     case E_PrimalSolutionSource::InteriorPointSearch:
         sourceDesc = "Interior point search";
         break;
+    case E_PrimalSolutionSource::RoundingAndRepair:
+        sourceDesc = "rounding and repair";
+        break;
     default:
         sourceDesc = "other";
         break;
@@ -137,8 +195,10 @@ bool PrimalSolver::checkPrimalSolutionPoint(PrimalSolution primalSol)
 
     primalSol.sourceDescription = sourceDesc;
 
-    // Recalculate if the objective to be sure it is correct
-    primalSol.objValue = env->problem->objectiveFunction->calculateValue(primalSol.point);
+    // Recalculate the objective to be sure it is correct, unless it was calculated when the candidate was added
+    if(!primalSol.isObjectiveValueExact)
+        primalSol.objValue = env->problem->objectiveFunction->calculateValue(primalSol.point);
+
     tmpObjVal = primalSol.objValue;
 
     // Check that solution fulfills bounds, project back otherwise
@@ -400,6 +460,9 @@ bool PrimalSolver::checkPrimalSolutionPoint(PrimalSolution primalSol)
         tmpObjVal = env->problem->objectiveFunction->calculateValue(tmpPoint);
     }
 
+    // Only the constraints with variables that differ from the previously checked point are recalculated
+    auto& constraintValues = getNumericConstraintValues(tmpPoint);
+
     // For example rootsearches may violate linear constraints
     bool acceptableType = (primalSol.sourceType == E_PrimalSolutionSource::MIPSolutionPool
         || primalSol.sourceType == E_PrimalSolutionSource::NLPFixedIntegers
@@ -420,7 +483,7 @@ bool PrimalSolver::checkPrimalSolutionPoint(PrimalSolution primalSol)
         if(env->problem->properties.numberOfLinearConstraints > 0)
         {
             auto maxLinearConstraintValue
-                = env->problem->getMaxNumericConstraintValue(tmpPoint, env->problem->linearConstraints);
+                = getMaxNumericConstraintValue(constraintValues, env->problem->linearConstraints);
 
             mostDevLinearConstraints.index = maxLinearConstraintValue.constraint->index;
             mostDevLinearConstraints.value = maxLinearConstraintValue.normalizedValue;
@@ -452,7 +515,7 @@ bool PrimalSolver::checkPrimalSolutionPoint(PrimalSolution primalSol)
         PairIndexValue mostDevQuadraticConstraints;
 
         auto maxQuadraticConstraintValue
-            = env->problem->getMaxNumericConstraintValue(tmpPoint, env->problem->quadraticConstraints);
+            = getMaxNumericConstraintValue(constraintValues, env->problem->quadraticConstraints);
 
         mostDevQuadraticConstraints.index = maxQuadraticConstraintValue.constraint->index;
         mostDevQuadraticConstraints.value = maxQuadraticConstraintValue.normalizedValue;
@@ -483,7 +546,7 @@ bool PrimalSolver::checkPrimalSolutionPoint(PrimalSolution primalSol)
         PairIndexValue mostDevNonlinearConstraints;
 
         auto maxNonlinearConstraintValue
-            = env->problem->getMaxNumericConstraintValue(tmpPoint, env->problem->nonlinearConstraints);
+            = getMaxNumericConstraintValue(constraintValues, env->problem->nonlinearConstraints);
 
         mostDevNonlinearConstraints.index = maxNonlinearConstraintValue.constraint->index;
         mostDevNonlinearConstraints.value = maxNonlinearConstraintValue.normalizedValue;
@@ -13,6 +13,10 @@
 #include "Enums.h"
 #include "Structs.h"
 
+#include "Model/Constraints.h"
+
+#include <mutex>
+
 namespace SHOT
 {
 
@@ -46,8 +50,19 @@ public:
     std::vector<PrimalFixedNLPCandidate> fixedPrimalNLPCandidates;
     std::vector<PrimalFixedNLPCandidate> usedPrimalNLPCandidates;
 
+    // Guards the primal solution candidates and the incumbent when these are updated from several threads
+    std::recursive_mutex primalSolutionMutex;
+
 private:
     EnvironmentPtr env;
+
+    // The constraint values in the previously checked point. Candidates are often close to each other, e.g., they
+    // differ only in a few discrete variables, so the values can be updated for the changed variables only. Guarded
+    // by primalSolutionMutex.
+    VectorDouble previousCheckedPoint;
+    NumericConstraintValues previousConstraintValues;
+
+    const NumericConstraintValues& getNumericConstraintValues(const VectorDouble& point);
 };
 
 } // namespace SHOT
\ No newline at end of file
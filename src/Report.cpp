@@ -1223,6 +1223,9 @@ void Report::outputSolutionReport()
             case E_PrimalSolutionSource::InteriorPointSearch:
                 sourceDesc = "Interior point search";
                 break;
+            case E_PrimalSolutionSource::RoundingAndRepair:
+                sourceDesc = "rounding and repair";
+                break;
             default:
                 sourceDesc = "other";
                 break;
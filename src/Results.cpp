@@ -472,6 +472,11 @@ std::string Results::getResultsOSrL()
             otherNode->SetAttribute(
                 "description", "The number of primal solutions found when searching for interior point");
             break;
+        case E_PrimalSolutionSource::RoundingAndRepair:
+            otherNode->SetAttribute("name", "NumberOfPrimalSolutionsFoundRoundingAndRepair");
+            otherNode->SetAttribute(
+                "description", "The number of primal solutions found by rounding and repairing dual solutions");
+            break;
         default:
             otherNode->SetAttribute("name", "NumberOfPrimalSolutionsFoundOther");
             otherNode->SetAttribute("description", "The number of primal solutions found with unknown method");
@@ -0,0 +1,123 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "RootsearchMethodBase.h"
+#include "../Output.h"
+#include "../Model/Problem.h"
+#include "../Results.h"
+#include "../PrimalSolver.h"
+#include "../Iteration.h"
+
+namespace SHOT
+{
+
+RootsearchMethodBase::RootsearchMethodBase(EnvironmentPtr envPtr) : env(envPtr) {}
+
+RootsearchMethodBase::~RootsearchMethodBase() = default;
+
+std::pair<VectorDouble, VectorDouble> RootsearchMethodBase::findZero(const VectorDouble& ptA, const VectorDouble& ptB,
+    int Nmax, double lambdaTol, double constrTol, const NonlinearConstraints constraints, bool addPrimalCandidate)
+{
+    std::vector<NumericConstraint*> tmpConstraints;
+    tmpConstraints.reserve(size(constraints));
+
+    for(auto& C : constraints)
+    {
+        tmpConstraints.push_back(std::dynamic_pointer_cast<NumericConstraint>(C).get());
+    }
+
+    return (findZero(ptA, ptB, Nmax, lambdaTol, constrTol, tmpConstraints, addPrimalCandidate));
+}
+
+std::pair<double, double> RootsearchMethodBase::findZero(const VectorDouble& pt, double objectiveLB,
+    double objectiveUB, [[maybe_unused]] int Nmax, [[maybe_unused]] double lambdaTol,
+    [[maybe_unused]] double constrTol, ObjectiveFunctionPtr objectiveFunction)
+{
+    // The difference between the objective function value and the auxiliary objective variable is linear in the
+    // variable, so the root is given directly
+    double objectiveValue = objectiveFunction->calculateValue(pt);
+
+    if((objectiveValue - objectiveLB) * (objectiveValue - objectiveUB) > 0)
+        throw Exception("Root search error: the objective value is not between the bounds.");
+
+    return (std::make_pair(objectiveValue, objectiveValue));
+}
+
+RootsearchMethodBase::LineSegment RootsearchMethodBase::initializeLineSegment(
+    const VectorDouble& ptA, const VectorDouble& ptB, const std::vector<NumericConstraint*>& constraints)
+{
+    if(ptA.size() != ptB.size())
+    {
+        env->output->outputError("        Root search error: sizes of points vary: " + std::to_string(ptA.size())
+            + " != " + std::to_string(ptB.size()));
+    }
+
+    if(constraints.size() == 0)
+    {
+        env->output->outputError("        No constraints selected for root search");
+    }
+
+    LineSegment segment;
+
+    if(auto sharedProblem = constraints[0]->ownerProblem.lock())
+    {
+        segment.problem = sharedProblem.get();
+    }
+
+    std::vector<NumericConstraint*> firstActiveConstraints;
+    std::vector<NumericConstraint*> secondActiveConstraints;
+
+    double valueFirstPt
+        = segment.problem->getMaxNumericConstraintValue(ptA, constraints, firstActiveConstraints).normalizedValue;
+    double valueSecondPt
+        = segment.problem->getMaxNumericConstraintValue(ptB, constraints, secondActiveConstraints).normalizedValue;
+
+    segment.activeConstraints = (valueFirstPt > 0) ? firstActiveConstraints : secondActiveConstraints;
+
+    if(segment.activeConstraints.size() == 0) // All constraints are fulfilled.
+    {
+        segment.isFeasible = true;
+        segment.lambdaInfeasible = (valueFirstPt > valueSecondPt) ? 1.0 : 0.0;
+        segment.lambdaFeasible = 1.0 - segment.lambdaInfeasible;
+
+        return (segment);
+    }
+
+    if(valueFirstPt > 0 && valueSecondPt > 0)
+        throw Exception("Root search error: both points violate the constraints.");
+
+    segment.lambdaInfeasible = (valueFirstPt > 0) ? 1.0 : 0.0;
+    segment.lambdaFeasible = 1.0 - segment.lambdaInfeasible;
+
+    return (segment);
+}
+
+std::pair<VectorDouble, VectorDouble> RootsearchMethodBase::createRootsearchResult(const VectorDouble& ptA,
+    const VectorDouble& ptB, double lambdaFeasible, double lambdaInfeasible, bool addPrimalCandidate)
+{
+    auto length = ptA.size();
+    VectorDouble feasiblePoint(length);
+    VectorDouble infeasiblePoint(length);
+
+    for(size_t i = 0; i < length; i++)
+    {
+        feasiblePoint[i] = lambdaFeasible * ptA[i] + (1 - lambdaFeasible) * ptB[i];
+        infeasiblePoint[i] = lambdaInfeasible * ptA[i] + (1 - lambdaInfeasible) * ptB[i];
+    }
+
+    if(addPrimalCandidate)
+    {
+        env->primalSolver->addPrimalSolutionCandidate(
+            feasiblePoint, E_PrimalSolutionSource::Rootsearch, env->results->getCurrentIteration()->iterationNumber);
+    }
+
+    return (std::make_pair(feasiblePoint, infeasiblePoint));
+}
+} // namespace SHOT
@@ -0,0 +1,55 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+#include "IRootsearchMethod.h"
+#include "../Environment.h"
+
+namespace SHOT
+{
+// Common functionality for the root search methods that search for the root of the maximum of the constraint functions
+// on the line segment between two points
+class RootsearchMethodBase : public IRootsearchMethod
+{
+public:
+    RootsearchMethodBase(EnvironmentPtr envPtr);
+    ~RootsearchMethodBase() override;
+
+    using IRootsearchMethod::findZero;
+
+    std::pair<VectorDouble, VectorDouble> findZero(const VectorDouble& ptA, const VectorDouble& ptB, int Nmax,
+        double lambdaTol, double constrTol, const NonlinearConstraints constraints, bool addPrimalCandidate) override;
+
+    std::pair<double, double> findZero(const VectorDouble& pt, double objectiveLB, double objectiveUB, int Nmax,
+        double lambdaTol, double constrTol, ObjectiveFunctionPtr objectiveFunction) override;
+
+protected:
+    EnvironmentPtr env;
+
+    // The points on the segment are lambda * ptA + (1 - lambda) * ptB
+    struct LineSegment
+    {
+        Problem* problem = nullptr;
+        std::vector<NumericConstraint*> activeConstraints; // The constraints violated in the infeasible end point
+        double lambdaInfeasible = 1.0;
+        double lambdaFeasible = 0.0;
+        bool isFeasible = false; // If no constraint is violated in either end point
+    };
+
+    // Evaluates the constraints in the end points of the segment. If both end points fulfill the constraints, the one
+    // with the largest constraint value is considered infeasible. Throws if both end points violate the constraints.
+    LineSegment initializeLineSegment(
+        const VectorDouble& ptA, const VectorDouble& ptB, const std::vector<NumericConstraint*>& constraints);
+
+    // Returns the feasible and infeasible points given by the lambdas, and adds the feasible one as a primal candidate
+    std::pair<VectorDouble, VectorDouble> createRootsearchResult(const VectorDouble& ptA, const VectorDouble& ptB,
+        double lambdaFeasible, double lambdaInfeasible, bool addPrimalCandidate);
+};
+} // namespace SHOT
@@ -15,14 +15,14 @@
 #include "../Results.h"
 #include "../PrimalSolver.h"
 #include "../Iteration.h"
+#include "../Utilities.h"
 
 #include "boost/math/tools/roots.hpp"
 
+#include <functional>
+
 namespace SHOT
 {
-std::vector<NumericConstraint*> activeConstraints;
-double lastActiveConstraintUpdateValue;
-
 Test::Test(EnvironmentPtr envPtr) : env(envPtr) {}
 
 Test::~Test()
@@ -57,15 +57,15 @@ double Test::operator()(const double x)
 
     auto currentConstraints = getActiveConstraints();
 
-    std::vector<NumericConstraint*> activeConstraints;
+    std::vector<NumericConstraint*> newActiveConstraints;
 
-    auto constraintValue = problem->getMaxNumericConstraintValue(ptNew, currentConstraints, activeConstraints);
+    auto constraintValue = problem->getMaxNumericConstraintValue(ptNew, currentConstraints, newActiveConstraints);
     double calculatedValue = constraintValue.normalizedValue;
 
     if(!constraintValue.isFulfilled && calculatedValue <= lastActiveConstraintUpdateValue
-        && activeConstraints.size() < currentConstraints.size())
+        && newActiveConstraints.size() < currentConstraints.size())
     {
-        setActiveConstraints(activeConstraints);
+        setActiveConstraints(newActiveConstraints);
         lastActiveConstraintUpdateValue = calculatedValue;
     }
 
@@ -92,7 +92,7 @@ RootsearchMethodBoost::RootsearchMethodBoost(EnvironmentPtr envPtr) : env(envPtr
     testObjective = std::make_unique<TestObjective>(env);
 }
 
-RootsearchMethodBoost::~RootsearchMethodBoost() { activeConstraints.clear(); }
+RootsearchMethodBoost::~RootsearchMethodBoost() { test->clearActiveConstraints(); }
 
 std::pair<VectorDouble, VectorDouble> RootsearchMethodBoost::findZero(const VectorDouble& ptA, const VectorDouble& ptB,
     int Nmax, double lambdaTol, double constrTol, const NonlinearConstraints constraints,
@@ -169,14 +169,76 @@ std::pair<VectorDouble, VectorDouble> RootsearchMethodBoost::findZero(const Vect
 
     PairDouble r1;
 
-    if(static_cast<ES_RootsearchMethod>(env->settings->getSetting<int>("Rootsearch.Method", "Subsolver"))
-        == ES_RootsearchMethod::BoostTOMS748)
+    bool useTOMS748 = static_cast<ES_RootsearchMethod>(env->settings->getSetting<int>("Rootsearch.Method", "Subsolver"))
+        == ES_RootsearchMethod::BoostTOMS748;
+
+    bool useBracketCache = env->settings->getSetting<bool>("Rootsearch.BracketCache.Use", "Subsolver");
+    bool isWarmStarted = false;
+
+    std::pair<double, VectorInteger> cacheKey;
+
+    // Consecutive root searches are often performed between the same interior point and nearby solution points, so
+    // the previous root is used to predict a narrower interval
+    if(useBracketCache)
     {
-        r1 = boost::math::tools::toms748_solve(*test, 0.0, 1.0, TerminationCondition(lambdaTol), max_iter);
+        VectorInteger constraintIndexes;
+        constraintIndexes.reserve(constraints.size());
+
+        for(auto& C : constraints)
+            constraintIndexes.push_back(C->index);
+
+        cacheKey = std::make_pair(Utilities::calculateHash(ptA), constraintIndexes);
+
+        if(auto cachedRoot = cachedRoots.find(cacheKey); cachedRoot != cachedRoots.end())
+        {
+            double bracketWidth = env->settings->getSetting<double>("Rootsearch.BracketCache.Width", "Subsolver");
+
+            double lowerLambda = std::max(0.0, cachedRoot->second - bracketWidth);
+            double upperLambda = std::min(1.0, cachedRoot->second + bracketWidth);
+
+            double lowerValue = (*test)(lowerLambda);
+            double upperValue = (*test)(upperLambda);
+
+            // Otherwise the search is performed on the full interval
+            if(lowerValue * upperValue <= 0.0)
+            {
+                isWarmStarted = true;
+
+                if(useTOMS748)
+                {
+                    r1 = boost::math::tools::toms748_solve(std::ref(*test), lowerLambda, upperLambda, lowerValue,
+                        upperValue, TerminationCondition(lambdaTol), max_iter);
+                }
+                else
+                {
+                    r1 = boost::math::tools::bisect(
+                        std::ref(*test), lowerLambda, upperLambda, TerminationCondition(lambdaTol), max_iter);
+                }
+            }
+        }
+    }
+
+    if(isWarmStarted)
+    {
+        env->output->outputTrace("        Root search warm started from cached bracket.");
+    }
+    else if(useTOMS748)
+    {
+        r1 = boost::math::tools::toms748_solve(
+            std::ref(*test), 0.0, 1.0, TerminationCondition(lambdaTol), max_iter);
     }
     else
     {
-        r1 = boost::math::tools::bisect(*test, 0.0, 1.0, TerminationCondition(lambdaTol), max_iter);
+        r1 = boost::math::tools::bisect(std::ref(*test), 0.0, 1.0, TerminationCondition(lambdaTol), max_iter);
+    }
+
+    if(useBracketCache)
+    {
+        // Limits the memory used since old interior points are not removed
+        if(cachedRoots.size() > 10000)
+            cachedRoots.clear();
+
+        cachedRoots[cacheKey] = (r1.first + r1.second) / 2.0;
     }
 
     int resFVals = env->solutionStatistics.numberOfFunctionEvalutions - tempFEvals;
@@ -12,6 +12,8 @@
 #include "IRootsearchMethod.h"
 #include "../Environment.h"
 
+#include <map>
+
 namespace SHOT
 {
 class Test
@@ -19,6 +21,10 @@ class Test
 private:
     EnvironmentPtr env;
 
+    // Scratch data for the current root search, kept per instance so that several root searches can run in parallel
+    std::vector<NumericConstraint*> activeConstraints;
+    double lastActiveConstraintUpdateValue = 0.0;
+
 public:
     Problem* problem;
 
@@ -88,5 +94,8 @@ private:
     std::unique_ptr<Test> test;
     std::unique_ptr<TestObjective> testObjective;
     EnvironmentPtr env;
+
+    // The roots found previously, with the hash of the first point and the constraint indexes as key
+    std::map<std::pair<double, VectorInteger>, double> cachedRoots;
 };
 } // namespace SHOT
\ No newline at end of file
@@ -0,0 +1,103 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "RootsearchMethodKarySection.h"
+#include "../Output.h"
+#include "../Settings.h"
+#include "../Model/Problem.h"
+
+namespace SHOT
+{
+
+RootsearchMethodKarySection::RootsearchMethodKarySection(EnvironmentPtr envPtr) : RootsearchMethodBase(envPtr) {}
+
+RootsearchMethodKarySection::~RootsearchMethodKarySection() = default;
+
+std::pair<VectorDouble, VectorDouble> RootsearchMethodKarySection::findZero(const VectorDouble& ptA,
+    const VectorDouble& ptB, int Nmax, double lambdaTol, [[maybe_unused]] double constrTol,
+    const std::vector<NumericConstraint*> constraints, bool addPrimalCandidate)
+{
+    auto segment = initializeLineSegment(ptA, ptB, constraints);
+
+    if(segment.isFeasible) // All constraints are fulfilled.
+        return (createRootsearchResult(ptA, ptB, segment.lambdaFeasible, segment.lambdaInfeasible, false));
+
+    auto problem = segment.problem;
+    auto& activeConstraints = segment.activeConstraints;
+
+    auto numberOfPoints = (size_t)env->settings->getSetting<int>("Rootsearch.KarySection.Points", "Subsolver");
+    auto length = ptA.size();
+
+    double lambdaInfeasible = segment.lambdaInfeasible;
+    double lambdaFeasible = segment.lambdaFeasible;
+
+    std::vector<VectorDouble> points(numberOfPoints, VectorDouble(length));
+    VectorDouble lambdas(numberOfPoints);
+
+    int rounds = 0;
+
+    while(rounds < Nmax && std::abs(lambdaInfeasible - lambdaFeasible) > lambdaTol)
+    {
+        double intervalLength = std::abs(lambdaFeasible - lambdaInfeasible);
+
+        // The points are ordered from the infeasible to the feasible end of the interval
+        double stepLength = (lambdaFeasible - lambdaInfeasible) / (numberOfPoints + 1);
+
+        for(size_t i = 0; i < numberOfPoints; i++)
+        {
+            lambdas[i] = lambdaInfeasible + (i + 1) * stepLength;
+
+            for(size_t j = 0; j < length; j++)
+                points[i][j] = lambdas[i] * ptA[j] + (1 - lambdas[i]) * ptB[j];
+        }
+
+        auto values = problem->getMaxNumericConstraintValues(points, activeConstraints);
+        rounds++;
+
+        // Continues in the first subinterval where the sign changes
+        double newLambdaFeasible = lambdaFeasible;
+
+        for(size_t i = 0; i < numberOfPoints; i++)
+        {
+            if(values[i] > 0)
+            {
+                lambdaInfeasible = lambdas[i];
+            }
+            else
+            {
+                newLambdaFeasible = lambdas[i];
+                break;
+            }
+        }
+
+        // The interval cannot be divided further in floating point arithmetic
+        if(std::abs(lambdaInfeasible - newLambdaFeasible) >= intervalLength)
+        {
+            lambdaFeasible = newLambdaFeasible;
+            break;
+        }
+
+        lambdaFeasible = newLambdaFeasible;
+    }
+
+    if(rounds >= Nmax)
+    {
+        env->output->outputDebug(
+            "        Warning, number of line search iterations " + std::to_string(rounds) + " reached!");
+    }
+    else
+    {
+        env->output->outputTrace("        Line search rounds: " + std::to_string(rounds)
+            + ". Function evaluations: " + std::to_string(rounds * numberOfPoints));
+    }
+
+    return (createRootsearchResult(ptA, ptB, lambdaFeasible, lambdaInfeasible, addPrimalCandidate));
+}
+} // namespace SHOT
@@ -0,0 +1,31 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+#include "RootsearchMethodBase.h"
+
+namespace SHOT
+{
+// Finds the root of the maximum of the constraint functions on the line segment between two points by evaluating k
+// equally spaced points in the interval containing the root in each round, and then continuing in the subinterval where
+// the sign changes. The points in a round are independent and are evaluated together.
+class RootsearchMethodKarySection : public RootsearchMethodBase
+{
+public:
+    RootsearchMethodKarySection(EnvironmentPtr envPtr);
+    ~RootsearchMethodKarySection() override;
+
+    using RootsearchMethodBase::findZero;
+
+    std::pair<VectorDouble, VectorDouble> findZero(const VectorDouble& ptA, const VectorDouble& ptB, int Nmax,
+        double lambdaTol, double constrTol, const std::vector<NumericConstraint*> constraints,
+        bool addPrimalCandidate) override;
+};
+} // namespace SHOT
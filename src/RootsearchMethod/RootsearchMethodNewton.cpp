@@ -0,0 +1,130 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "RootsearchMethodNewton.h"
+#include "../Output.h"
+#include "../Model/Problem.h"
+
+#include <cmath>
+
+namespace SHOT
+{
+
+RootsearchMethodNewton::RootsearchMethodNewton(EnvironmentPtr envPtr) : RootsearchMethodBase(envPtr) {}
+
+RootsearchMethodNewton::~RootsearchMethodNewton() = default;
+
+std::pair<double, double> RootsearchMethodNewton::calculateValueAndDerivative(Problem* problem,
+    const VectorDouble& ptA, const VectorDouble& ptB, double lambda,
+    std::vector<NumericConstraint*>& activeConstraints)
+{
+    auto length = ptA.size();
+    VectorDouble point(length);
+
+    for(size_t i = 0; i < length; i++)
+        point[i] = lambda * ptA[i] + (1 - lambda) * ptB[i];
+
+    std::vector<NumericConstraint*> newActiveConstraints;
+    auto constraintValue = problem->getMaxNumericConstraintValue(point, activeConstraints, newActiveConstraints);
+
+    // The directional derivative of the constraint attaining the maximum along the direction ptA - ptB
+    double derivative = 0.0;
+
+    for(auto& G : constraintValue.constraint->calculateGradient(point, false))
+        derivative += G.second * (ptA[G.first->index] - ptB[G.first->index]);
+
+    if(constraintValue.normalizedLHSValue > constraintValue.normalizedRHSValue)
+        derivative = -derivative;
+
+    return (std::make_pair(constraintValue.normalizedValue, derivative));
+}
+
+std::pair<VectorDouble, VectorDouble> RootsearchMethodNewton::findZero(const VectorDouble& ptA, const VectorDouble& ptB,
+    int Nmax, double lambdaTol, [[maybe_unused]] double constrTol, const std::vector<NumericConstraint*> constraints,
+    bool addPrimalCandidate)
+{
+    auto segment = initializeLineSegment(ptA, ptB, constraints);
+
+    if(segment.isFeasible) // All constraints are fulfilled.
+        return (createRootsearchResult(ptA, ptB, segment.lambdaFeasible, segment.lambdaInfeasible, false));
+
+    auto problem = segment.problem;
+    auto& activeConstraints = segment.activeConstraints;
+
+    // The Newton steps are started from the infeasible point, since they then approach the root from the infeasible
+    // side if the constraints are convex.
+    double lambdaInfeasible = segment.lambdaInfeasible;
+    double lambdaFeasible = segment.lambdaFeasible;
+
+    double lambda = lambdaInfeasible;
+    auto [value, derivative] = calculateValueAndDerivative(problem, ptA, ptB, lambda, activeConstraints);
+    int iterations = 1;
+
+    while(iterations < Nmax && std::abs(lambdaInfeasible - lambdaFeasible) > lambdaTol)
+    {
+        double newtonStep = (derivative != 0.0) ? -value / derivative : 0.0;
+        double nextLambda = lambda + newtonStep;
+
+        bool isNewtonStepConverged = (derivative != 0.0 && std::abs(newtonStep) <= lambdaTol);
+
+        if(isNewtonStepConverged)
+        {
+            // The root is found to the tolerance, so a slightly longer step should give a feasible point on the other
+            // side of the root
+            nextLambda
+                = lambda + std::copysign(std::max(2.0 * std::abs(newtonStep), lambdaTol), lambdaFeasible - lambda);
+
+            if(nextLambda == lambda)
+                nextLambda = std::nextafter(lambda, lambdaFeasible);
+        }
+
+        // Bisection step if the Newton step is not inside the interval containing the root
+        if(derivative == 0.0 || nextLambda <= std::min(lambdaInfeasible, lambdaFeasible)
+            || nextLambda >= std::max(lambdaInfeasible, lambdaFeasible))
+        {
+            nextLambda = (lambdaInfeasible + lambdaFeasible) / 2.0;
+            isNewtonStepConverged = false;
+        }
+
+        lambda = nextLambda;
+        std::tie(value, derivative) = calculateValueAndDerivative(problem, ptA, ptB, lambda, activeConstraints);
+        iterations++;
+
+        if(value > 0)
+        {
+            lambdaInfeasible = lambda;
+        }
+        else if(value < 0)
+        {
+            lambdaFeasible = lambda;
+        }
+        else
+        {
+            lambdaInfeasible = lambda;
+            lambdaFeasible = lambda;
+        }
+
+        if(isNewtonStepConverged)
+            break;
+    }
+
+    if(iterations >= Nmax)
+    {
+        env->output->outputDebug(
+            "        Warning, number of line search iterations " + std::to_string(iterations) + " reached!");
+    }
+    else
+    {
+        env->output->outputTrace("        Line search iterations: " + std::to_string(iterations));
+    }
+
+    return (createRootsearchResult(ptA, ptB, lambdaFeasible, lambdaInfeasible, addPrimalCandidate));
+}
+} // namespace SHOT
@@ -0,0 +1,37 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+#include "RootsearchMethodBase.h"
+
+namespace SHOT
+{
+// Finds the root of the maximum of the constraint functions on the line segment between two points with Newton steps,
+// where the derivative along the segment is the gradient of the active constraint times the direction of the segment.
+// Bisection is used whenever the Newton step would leave the interval known to contain the root.
+class RootsearchMethodNewton : public RootsearchMethodBase
+{
+public:
+    RootsearchMethodNewton(EnvironmentPtr envPtr);
+    ~RootsearchMethodNewton() override;
+
+    using RootsearchMethodBase::findZero;
+
+    std::pair<VectorDouble, VectorDouble> findZero(const VectorDouble& ptA, const VectorDouble& ptB, int Nmax,
+        double lambdaTol, double constrTol, const std::vector<NumericConstraint*> constraints,
+        bool addPrimalCandidate) override;
+
+private:
+    // Calculates the value of the maximum function and its derivative w.r.t. lambda at the point
+    // lambda * ptA + (1 - lambda) * ptB
+    std::pair<double, double> calculateValueAndDerivative(Problem* problem, const VectorDouble& ptA,
+        const VectorDouble& ptB, double lambda, std::vector<NumericConstraint*>& activeConstraints);
+};
+} // namespace SHOT
@@ -794,6 +794,8 @@ int main(int argc, char* argv[])
     env->modelingSystem = NULL;
     env->dualSolver = NULL;
     env->primalSolver = NULL;
+    env->pointStore = NULL;
+    env->threadPool = NULL;
     env->settings = NULL;
     env->output = NULL;
     env->report = NULL;
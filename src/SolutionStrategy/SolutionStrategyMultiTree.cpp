@@ -49,6 +49,7 @@
 
 #include "../Tasks/TaskInitializeRootsearch.h"
 #include "../Tasks/TaskSelectHyperplanePointsESH.h"
+#include "../Tasks/TaskSelectHyperplanePointsMcCormick.h"
 #include "../Tasks/TaskSelectHyperplanePointsECP.h"
 #include "../Tasks/TaskAddHyperplanes.h"
 #include "../Tasks/TaskAddPrimalReductionCut.h"
@@ -56,7 +57,9 @@
 
 #include "../Tasks/TaskSelectPrimalCandidatesFromSolutionPool.h"
 #include "../Tasks/TaskSelectPrimalCandidatesFromRootsearch.h"
+#include "../Tasks/TaskSelectPrimalCandidatesFromRounding.h"
 #include "../Tasks/TaskSelectPrimalCandidatesFromNLP.h"
+#include "../Tasks/TaskCollectPrimalCandidatesFromNLP.h"
 #include "../Tasks/TaskSelectPrimalFixedNLPPointsFromSolutionPool.h"
 #include "../Tasks/TaskClearFixedPrimalCandidates.h"
 
@@ -86,11 +89,13 @@ SolutionStrategyMultiTree::SolutionStrategyMultiTree(EnvironmentPtr envPtr)
     env->timing->createTimer("DualProblemsIntegerFixed", "  - solving integer-fixed problems");
     env->timing->createTimer("DualProblemsDiscrete", "  - solving MIP problems");
     env->timing->createTimer("DualCutGenerationRootSearch", "  - root search for constraint cuts");
+    env->timing->createTimer("DualCutGenerationMcCormick", "  - McCormick relaxation cuts");
     env->timing->createTimer("DualObjectiveRootSearch", "  - root search for objective cut");
 
     env->timing->createTimer("PrimalStrategy", "- primal strategy");
     env->timing->createTimer("PrimalBoundStrategyNLP", "  - solving NLP problems");
     env->timing->createTimer("PrimalBoundStrategyRootSearch", "  - performing root searches");
+    env->timing->createTimer("PrimalBoundStrategyRounding", "  - rounding and repair");
 
     auto tFinalizeSolution = std::make_shared<TaskSequential>(env);
 
@@ -141,6 +146,12 @@ SolutionStrategyMultiTree::SolutionStrategyMultiTree(EnvironmentPtr envPtr)
     env->tasks->addTask(tSelectPrimSolPool, "SelectPrimSolPool");
     std::dynamic_pointer_cast<TaskSequential>(tFinalizeSolution)->addTask(tSelectPrimSolPool);
 
+    if(env->settings->getSetting<bool>("Rounding.Use", "Primal"))
+    {
+        auto tSelectPrimRounding = std::make_shared<TaskSelectPrimalCandidatesFromRounding>(env);
+        env->tasks->addTask(tSelectPrimRounding, "SelectPrimRounding");
+    }
+
     if(env->settings->getSetting<bool>("Rootsearch.Use", "Primal")
         && env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
     {
@@ -203,8 +214,19 @@ SolutionStrategyMultiTree::SolutionStrategyMultiTree(EnvironmentPtr envPtr)
         = std::make_shared<TaskCheckMaxNumberOfPrimalReductionCuts>(env, "FinalizeSolution");
     env->tasks->addTask(tCheckMaxNumberOfObjectiveCuts, "CheckMaxObjectiveCuts");
 
-    if(env->settings->getSetting<bool>("FixedInteger.Use", "Primal") && env->reformulatedProblem->properties.isDiscrete)
+    // If pipelined, the fixed NLP problems are solved in a separate thread while the next MIP problem is solved
+    bool useFixedNLP = env->settings->getSetting<bool>("FixedInteger.Use", "Primal")
+        && env->reformulatedProblem->properties.isDiscrete;
+    bool isPipelined = useFixedNLP && env->settings->getSetting<bool>("TreeStrategy.Multi.Pipelined", "Dual");
+
+    auto tCollectPrimNLP = std::make_shared<TaskCollectPrimalCandidatesFromNLP>(env, false);
+    auto tWaitForPrimNLP = std::make_shared<TaskCollectPrimalCandidatesFromNLP>(env, true);
+
+    if(useFixedNLP)
     {
+        if(isPipelined)
+            std::dynamic_pointer_cast<TaskSequential>(tFinalizeSolution)->addTask(tWaitForPrimNLP);
+
         auto tSelectPrimFixedNLPSolPool = std::make_shared<TaskSelectPrimalFixedNLPPointsFromSolutionPool>(env);
         env->tasks->addTask(tSelectPrimFixedNLPSolPool, "SelectPrimFixedNLPSolPool");
         std::dynamic_pointer_cast<TaskSequential>(tFinalizeSolution)->addTask(tSelectPrimFixedNLPSolPool);
@@ -215,17 +237,21 @@ SolutionStrategyMultiTree::SolutionStrategyMultiTree(EnvironmentPtr envPtr)
         if(NLPProblemSource == ES_PrimalNLPProblemSource::Both
             || NLPProblemSource == ES_PrimalNLPProblemSource::OriginalProblem)
         {
-            auto tSelectPrimNLPCheck = std::make_shared<TaskSelectPrimalCandidatesFromNLP>(env, false);
+            auto tSelectPrimNLPCheck = std::make_shared<TaskSelectPrimalCandidatesFromNLP>(env, false, isPipelined);
             env->tasks->addTask(tSelectPrimNLPCheck, "SelectPrimNLPCheckOriginal");
             std::dynamic_pointer_cast<TaskSequential>(tFinalizeSolution)->addTask(tSelectPrimNLPCheck);
+            tCollectPrimNLP->addTask(tSelectPrimNLPCheck);
+            tWaitForPrimNLP->addTask(tSelectPrimNLPCheck);
         }
 
         if(NLPProblemSource == ES_PrimalNLPProblemSource::Both
             || NLPProblemSource == ES_PrimalNLPProblemSource::ReformulatedProblem)
         {
-            auto tSelectPrimNLPCheck = std::make_shared<TaskSelectPrimalCandidatesFromNLP>(env, true);
+            auto tSelectPrimNLPCheck = std::make_shared<TaskSelectPrimalCandidatesFromNLP>(env, true, isPipelined);
             env->tasks->addTask(tSelectPrimNLPCheck, "SelectPrimNLPCheckReformulated");
             std::dynamic_pointer_cast<TaskSequential>(tFinalizeSolution)->addTask(tSelectPrimNLPCheck);
+            tCollectPrimNLP->addTask(tSelectPrimNLPCheck);
+            tWaitForPrimNLP->addTask(tSelectPrimNLPCheck);
         }
 
         auto tClearPrimNLPCands = std::make_shared<TaskClearFixedPrimalCandidates>(env);
@@ -255,6 +281,16 @@ SolutionStrategyMultiTree::SolutionStrategyMultiTree(EnvironmentPtr envPtr)
     auto tExecuteSolLimStrategy = std::make_shared<TaskExecuteSolutionLimitStrategy>(env);
     env->tasks->addTask(tExecuteSolLimStrategy, "ExecSolLimStrategy");
 
+    // The McCormick cuts are selected first, so that they are kept if a supporting hyperplane is generated in the same
+    // point for the same constraint
+    if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0
+        && env->reformulatedProblem->properties.convexity != E_ProblemConvexity::Convex
+        && env->settings->getSetting<bool>("HyperplaneCuts.UseMcCormickCuts", "Dual"))
+    {
+        auto tSelectMcCormickHPPts = std::make_shared<TaskSelectHyperplanePointsMcCormick>(env);
+        env->tasks->addTask(tSelectMcCormickHPPts, "SelectMcCormickHPPts");
+    }
+
     if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
     {
         if(static_cast<ES_HyperplaneCutStrategy>(env->settings->getSetting<int>("CutStrategy", "Dual"))
@@ -295,6 +331,9 @@ SolutionStrategyMultiTree::SolutionStrategyMultiTree(EnvironmentPtr envPtr)
         env->tasks->addTask(tPresolve, "Presolve2");
     }
 
+    if(isPipelined)
+        env->tasks->addTask(tCollectPrimNLP, "CollectPrimNLP");
+
     auto tGoto = std::make_shared<TaskGoto>(env, "SolveIter");
     env->tasks->addTask(tGoto, "Goto");
 
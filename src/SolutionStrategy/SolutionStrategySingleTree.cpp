@@ -49,6 +49,7 @@
 
 #include "../Tasks/TaskInitializeRootsearch.h"
 #include "../Tasks/TaskSelectHyperplanePointsESH.h"
+#include "../Tasks/TaskSelectHyperplanePointsMcCormick.h"
 #include "../Tasks/TaskSelectHyperplanePointsECP.h"
 #include "../Tasks/TaskAddHyperplanes.h"
 #include "../Tasks/TaskAddPrimalReductionCut.h"
@@ -85,12 +86,17 @@ SolutionStrategySingleTree::SolutionStrategySingleTree(EnvironmentPtr envPtr)
     env->timing->createTimer("DualStrategy", "- dual strategy");
     env->timing->createTimer("DualProblemsDiscrete", "  - solving MIP problems");
     env->timing->createTimer("DualCutGenerationRootSearch", "  - root search for constraint cuts");
+    env->timing->createTimer("DualCutGenerationMcCormick", "  - McCormick relaxation cuts");
     env->timing->createTimer("DualObjectiveRootSearch", "  - root search for objective cut");
 
     env->timing->createTimer("PrimalStrategy", "- primal strategy");
     env->timing->createTimer("PrimalBoundStrategyNLP", "  - solving NLP problems");
     env->timing->createTimer("PrimalBoundStrategyRootSearch", "  - performing root searches");
 
+    // The derivatives may be calculated in several callback threads at the same time, so the tapes are recorded here
+    env->problem->prepareFactorableFunctions();
+    env->reformulatedProblem->prepareFactorableFunctions();
+
     auto tFinalizeSolution = std::make_shared<TaskSequential>(env);
 
     auto tInitMIPSolver = std::make_shared<TaskInitializeDualSolver>(env, true);
@@ -237,6 +243,16 @@ SolutionStrategySingleTree::SolutionStrategySingleTree(EnvironmentPtr envPtr)
         env->tasks->addTask(tExecuteRelaxStrategy, "ExecRelaxStrategy");
     }
 
+    // The McCormick cuts are selected first, so that they are kept if a supporting hyperplane is generated in the same
+    // point for the same constraint
+    if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0
+        && env->reformulatedProblem->properties.convexity != E_ProblemConvexity::Convex
+        && env->settings->getSetting<bool>("HyperplaneCuts.UseMcCormickCuts", "Dual"))
+    {
+        auto tSelectMcCormickHPPts = std::make_shared<TaskSelectHyperplanePointsMcCormick>(env);
+        env->tasks->addTask(tSelectMcCormickHPPts, "SelectMcCormickHPPts");
+    }
+
     if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
     {
         if(static_cast<ES_HyperplaneCutStrategy>(env->settings->getSetting<int>("CutStrategy", "Dual"))
@@ -11,6 +11,8 @@
 #include "Solver.h"
 
 #include "DualSolver.h"
+#include "PointStore.h"
+#include "ThreadPool.h"
 #include "PrimalSolver.h"
 #include "Report.h"
 #include "Results.h"
@@ -80,6 +82,8 @@ Solver::Solver()
 
     env->dualSolver = std::make_shared<DualSolver>(env);
     env->primalSolver = std::make_shared<PrimalSolver>(env);
+    env->pointStore = std::make_shared<PointStore>(env);
+    env->threadPool = std::make_shared<ThreadPool>(env);
     initializeSettings();
 }
 
@@ -111,6 +115,8 @@ Solver::Solver(std::shared_ptr<spdlog::sinks::sink> consoleSink)
 
     env->dualSolver = std::make_shared<DualSolver>(env);
     env->primalSolver = std::make_shared<PrimalSolver>(env);
+    env->pointStore = std::make_shared<PointStore>(env);
+    env->threadPool = std::make_shared<ThreadPool>(env);
     initializeSettings();
 }
 
@@ -712,6 +718,19 @@ void Solver::initializeSettings()
     env->settings->createSettingGroup("Dual", "HyperplaneCuts", "Generated hyperplane cuts",
         "These settings control how the cutting planes or supporting hyperplanes are generated.");
 
+    env->settings->createSetting("HyperplaneCuts.Cleanup.CoefficientTolerance", "Dual", 1e-9,
+        "Coefficients smaller than this factor times the largest coefficient are removed from the cuts if possible",
+        0.0, 1.0);
+
+    env->settings->createSetting("HyperplaneCuts.Cleanup.MaxCoefficientRange", "Dual", 1e12,
+        "Cuts with a larger ratio between the largest and smallest coefficient are not added", 1.0, SHOT_DBL_MAX);
+
+    env->settings->createSetting("HyperplaneCuts.Cleanup.MaxConstantChange", "Dual", 1e-6,
+        "Maximal total change of the cut constant when removing small coefficients", 0.0, SHOT_DBL_MAX);
+
+    env->settings->createSetting("HyperplaneCuts.Cleanup.Use", "Dual", true,
+        "Remove small coefficients from and rescale the cuts before adding them to the MIP solver");
+
     env->settings->createSetting("HyperplaneCuts.ConstraintSelectionFactor", "Dual", 0.5,
         "The fraction of violated constraints to generate supporting hyperplanes / cutting planes for", 0.0, 1.0);
 
@@ -724,9 +743,21 @@ void Solver::initializeSettings()
     env->settings->createSetting("HyperplaneCuts.MaxPerIteration", "Dual", 200,
         "Maximal number of hyperplanes to add per iteration", 0, SHOT_INT_MAX);
 
+    env->settings->createSetting("HyperplaneCuts.MinimizeIntegerCuts", "Dual", true,
+        "Only include the discrete variables needed to prove the integer combination infeasible in integer cuts");
+
+    env->settings->createSetting("HyperplaneCuts.Selection.MaxParallelism", "Dual", 0.999,
+        "Cuts that are more parallel (cosine of angle) to a more efficient or dominating cut are not added", 0.0, 1.0);
+
+    env->settings->createSetting("HyperplaneCuts.Selection.Use", "Dual", true,
+        "Select a diverse subset of the generated cuts based on efficacy and parallelism");
+
     env->settings->createSetting("HyperplaneCuts.UseIntegerCuts", "Dual", false,
         "Add integer cuts for infeasible integer-combinations for binary problems");
 
+    env->settings->createSetting("HyperplaneCuts.UseMcCormickCuts", "Dual", true,
+        "Add cuts from the McCormick relaxations of violated nonconvex constraints");
+
     env->settings->createSetting("HyperplaneCuts.SaveHyperplanePoints", "Dual", false,
         "Whether to save the points in the generated hyperplanes list", false);
 
@@ -793,6 +824,15 @@ void Solver::initializeSettings()
     env->settings->createSetting(
         "MIP.Presolve.UpdateObtainedBounds", "Dual", true, "Update bounds (from presolve) to the MIP model");
 
+    env->settings->createSetting("MIP.SolutionLimit.Budget.InitialRelativeGap", "Dual", 0.1,
+        "Initial relative gap for the MIP problems with the gap and time budget strategy", 0.0, 1.0);
+
+    env->settings->createSetting("MIP.SolutionLimit.Budget.InitialTimeLimit", "Dual", 10.0,
+        "Initial time limit (s) for the MIP problems with the gap and time budget strategy", 0.0, SHOT_DBL_MAX);
+
+    env->settings->createSetting("MIP.SolutionLimit.Budget.TighteningFactor", "Dual", 0.1,
+        "Factor for tightening the relative gap with the gap and time budget strategy", 0.0, 1.0);
+
     env->settings->createSetting("MIP.SolutionLimit.ForceOptimal.Iteration", "Dual", 10000,
         "Iterations without dual bound updates for forcing optimal MIP solution", 0, SHOT_INT_MAX);
 
@@ -804,6 +844,16 @@ void Solver::initializeSettings()
 
     env->settings->createSetting("MIP.SolutionLimit.Initial", "Dual", 1, "Initial MIP solution limit", 1, SHOT_INT_MAX);
 
+    VectorString enumSolutionLimitStrategy;
+    enumSolutionLimitStrategy.push_back("Increase");
+    enumSolutionLimitStrategy.push_back("Adaptive");
+    enumSolutionLimitStrategy.push_back("Unlimited");
+    enumSolutionLimitStrategy.push_back("Gap and time budget");
+    env->settings->createSetting("MIP.SolutionLimit.Strategy", "Dual",
+        static_cast<int>(ES_MIPSolutionLimitStrategy::Increase), "How to limit the effort when solving MIP problems",
+        enumSolutionLimitStrategy, 0);
+    enumSolutionLimitStrategy.clear();
+
     env->settings->createSetting("MIP.SolutionLimit.UpdateTolerance", "Dual", 0.001,
         "The constraint tolerance for when to update MIP solution limit", 0, SHOT_DBL_MAX);
 
@@ -821,6 +871,9 @@ void Solver::initializeSettings()
     env->settings->createSetting(
         "MIP.UpdateObjectiveBounds", "Dual", false, "Update nonlinear objective variable bounds to primal/dual bounds");
 
+    env->settings->createSetting("MIP.UseNames", "Dual", true,
+        "Pass variable and constraint names to the MIP solver. Disabling saves memory and time on large problems");
+
     // Primal settings: reduction cuts for nonconvex problems
 
     env->settings->createSettingGroup("Dual", "ReductionCut", "Dual reduction cut",
@@ -872,6 +925,9 @@ void Solver::initializeSettings()
         "The main strategy to use", enumSolutionStrategy, 0);
     enumSolutionStrategy.clear();
 
+    env->settings->createSetting("TreeStrategy.Multi.Pipelined", "Dual", false,
+        "Solve the fixed NLP problems in a separate thread while the next MIP problem is solved");
+
     env->settings->createSetting("TreeStrategy.Multi.Reinitialize", "Dual", false,
         "Reinitialize the dual model in the subsolver each iteration", true);
 
@@ -945,6 +1001,22 @@ void Solver::initializeSettings()
     env->settings->createSetting("Convexity.Quadratics.EigenValueTolerance", "Model", 1e-5,
         "Convexity tolerance for the eigenvalues of the Hessian matrix for quadratic terms", 0.0, SHOT_DBL_MAX);
 
+    // Settings for compiling nonlinear expressions to native code
+
+    env->settings->createSettingGroup("Model", "JIT", "Compiled nonlinear expressions",
+        "These settings control the compilation of nonlinear expressions to native code. Requires that SHOT is built "
+        "with HAS_JIT and that a C compiler is available at runtime.");
+
+    env->settings->createSetting("JIT.CachePath", "Model", empty,
+        "Directory where the compiled expressions are stored and reused, the temporary directory if empty");
+
+    env->settings->createSetting("JIT.Compiler", "Model", std::string("cc"), "The C compiler command to use");
+
+    env->settings->createSetting("JIT.CompilerFlags", "Model", std::string("-O2"), "Flags passed to the C compiler");
+
+    env->settings->createSetting(
+        "JIT.Use", "Model", false, "Evaluate nonlinear constraints and objective using compiled native code");
+
     // Variable settings
 
     env->settings->createSettingGroup("Model", "Variables", "Variables",
@@ -1209,6 +1281,17 @@ void Solver::initializeSettings()
 
     env->settings->createSetting("Rootsearch.Use", "Primal", true, "Use a rootsearch to find primal solutions");
 
+    // Primal settings: rounding and repair
+
+    env->settings->createSettingGroup("Primal", "Rounding", "Rounding and repair",
+        "SHOT can round the dual solution point and repair the violated constraints with greedy variable moves for "
+        "the linear constraints and projected gradient steps for the nonlinear ones.");
+
+    env->settings->createSetting("Rounding.IterationLimit", "Primal", 100,
+        "Max number of repair steps for the linear and nonlinear constraints respectively", 0, SHOT_INT_MAX);
+
+    env->settings->createSetting("Rounding.Use", "Primal", true, "Use rounding and repair to find primal solutions");
+
     // Primal settings: tolerances for accepting primal solutions
 
     env->settings->createSettingGroup("Primal", "Tolerances", "Primal solution tolerances",
@@ -1476,12 +1559,23 @@ void Solver::initializeSettings()
     env->settings->createSetting("Rootsearch.ActiveConstraintTolerance", "Subsolver", 0.0,
         "Epsilon constraint tolerance for root search", 0.0, SHOT_DBL_MAX);
 
+    env->settings->createSetting("Rootsearch.BracketCache.Use", "Subsolver", true,
+        "Start the root search from an interval around the root previously found for the same point and constraints");
+
+    env->settings->createSetting("Rootsearch.BracketCache.Width", "Subsolver", 0.05,
+        "Half-width of the interval around the previous root", 0.0, 1.0);
+
+    env->settings->createSetting("Rootsearch.KarySection.Points", "Subsolver", 8,
+        "Number of points evaluated together in each round of the k-ary section root search", 1, 1000);
+
     env->settings->createSetting(
         "Rootsearch.MaxIterations", "Subsolver", 100, "Maximal root search iterations", 0, SHOT_INT_MAX);
 
     VectorString enumRootsearchMethod;
     enumRootsearchMethod.push_back("TOMS748");
     enumRootsearchMethod.push_back("Bisection");
+    enumRootsearchMethod.push_back("Safeguarded Newton");
+    enumRootsearchMethod.push_back("K-ary section");
     env->settings->createSetting("Rootsearch.Method", "Subsolver", static_cast<int>(ES_RootsearchMethod::BoostTOMS748),
         "Root search method to use", enumRootsearchMethod, 0);
     enumRootsearchMethod.clear();
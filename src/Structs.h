@@ -13,7 +13,9 @@
 #include "Enums.h"
 
 #include <limits>
+#include <map>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -73,6 +75,8 @@ class Timing;
 class Iteration;
 class DualSolver;
 class PrimalSolver;
+class PointStore;
+class ThreadPool;
 
 class Constraint;
 class NumericConstraint;
@@ -91,6 +95,8 @@ using TaskHandlerPtr = std::shared_ptr<TaskHandler>;
 using TimingPtr = std::shared_ptr<Timing>;
 using DualSolverPtr = std::shared_ptr<DualSolver>;
 using PrimalSolverPtr = std::shared_ptr<PrimalSolver>;
+using PointStorePtr = std::shared_ptr<PointStore>;
+using ThreadPoolPtr = std::shared_ptr<ThreadPool>;
 using IterationPtr = std::shared_ptr<Iteration>;
 
 using ConstraintPtr = std::shared_ptr<Constraint>;
@@ -127,6 +133,7 @@ struct SolutionPoint
     double objectiveValue;
     int iterFound;
     PairIndexValue maxDeviation;
+    bool isMaxDeviationCalculated = true; // False if maxDeviation is to be calculated on demand
     bool isRelaxedPoint = false;
     double hashValue;
 };
@@ -143,6 +150,7 @@ struct PrimalSolution
     E_PrimalSolutionSource sourceType;
     std::string sourceDescription;
     double objValue;
+    bool isObjectiveValueExact = false; // Has objValue been calculated with the objective of the original problem?
     int iterFound;
     PairIndexValue maxDevatingConstraintLinear { -1, SHOT_DBL_INF };
     PairIndexValue maxDevatingConstraintQuadratic { -1, SHOT_DBL_INF };
@@ -172,23 +180,59 @@ struct DualSolution
     bool displayed; // Has the dual solution been displayed on console?
 };
 
+// An immutable point that can be shared, e.g., by all hyperplanes generated in the same point. Identical points are
+// deduplicated by PointStore. Assigning a VectorDouble creates a new point.
+class PointHandle
+{
+public:
+    PointHandle() = default;
+    PointHandle(const VectorDouble& values) : point(std::make_shared<const VectorDouble>(values)) {};
+    PointHandle(std::shared_ptr<const VectorDouble> values) : point(std::move(values)) {};
+
+    inline const VectorDouble& get() const { return (point ? *point : emptyPoint); }
+    inline operator const VectorDouble&() const { return (get()); }
+
+    inline size_t size() const { return (get().size()); }
+    inline bool empty() const { return (get().empty()); }
+
+    inline const double& at(size_t index) const { return (get().at(index)); }
+    inline const double& operator[](size_t index) const { return (get()[index]); }
+
+    inline VectorDouble::const_iterator begin() const { return (get().begin()); }
+    inline VectorDouble::const_iterator end() const { return (get().end()); }
+
+    // Releases this reference to the point
+    inline void clear() { point.reset(); }
+
+    inline bool isSameAs(const PointHandle& other) const { return (point == other.point); }
+
+private:
+    std::shared_ptr<const VectorDouble> point;
+    inline static const VectorDouble emptyPoint;
+
+    friend class PointStore;
+};
+
 struct Hyperplane
 {
     NumericConstraintPtr sourceConstraint;
     int sourceConstraintIndex; // -1 if objective function
-    VectorDouble generatedPoint;
+    PointHandle generatedPoint;
     double objectiveFunctionValue; // Used for the objective cuts only
     E_HyperplaneSource source;
     bool isObjectiveHyperplane = false;
     bool isSourceConvex = false;
     double pointHash;
+
+    // The coefficients and constant of the cut, if already calculated, so that these are only calculated once
+    std::optional<std::pair<std::map<int, double>, double>> terms;
 };
 
 struct GeneratedHyperplane
 {
     NumericConstraintPtr sourceConstraint;
     int sourceConstraintIndex; // -1 if objective function
-    VectorDouble generatedPoint;
+    PointHandle generatedPoint;
     E_HyperplaneSource source = E_HyperplaneSource::None;
     bool isLazy = false;
     bool isRemoved = false;
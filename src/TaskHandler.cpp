@@ -10,6 +10,9 @@
 
 #include "TaskHandler.h"
 
+#include "Settings.h"
+#include "Timing.h"
+
 #include <algorithm>
 
 namespace SHOT
@@ -91,4 +94,21 @@ TaskPtr TaskHandler::getTask(std::string taskID)
     TaskExceptionNotFound e(env, taskID);
     throw(e);
 }
+
+bool TaskHandler::isCancelled()
+{
+    if(terminated)
+        return (true);
+
+    if(numberOfCancellationChecks++ % 64 == 0)
+        timeLimitReached = (getRemainingTime() <= 0.0);
+
+    return (timeLimitReached);
+}
+
+double TaskHandler::getRemainingTime()
+{
+    return (std::max(0.0,
+        env->settings->getSetting<double>("TimeLimit", "Termination") - env->timing->getElapsedTime("Total")));
+}
 } // namespace SHOT
\ No newline at end of file
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <list>
 #include <string>
 #include <utility>
@@ -37,6 +38,13 @@ public:
     void terminate() { terminated = true; }
     inline bool isTerminated() { return terminated; }
 
+    // Whether the solver has been terminated or the time limit has been reached. Long-running subroutines poll this in
+    // their inner loops and return early, so it only reads the timer every few calls.
+    bool isCancelled();
+
+    // The time (s) left until the time limit of the solver is reached
+    double getRemainingTime();
+
 private:
     std::list<std::pair<std::string, TaskPtr>>::iterator nextTask;
     std::string nextTaskID;
@@ -45,6 +53,9 @@ private:
 
     EnvironmentPtr env;
 
-    bool terminated = false;
+    std::atomic<bool> terminated = false;
+
+    std::atomic<bool> timeLimitReached = false;
+    std::atomic<unsigned int> numberOfCancellationChecks = 0;
 };
 }
\ No newline at end of file
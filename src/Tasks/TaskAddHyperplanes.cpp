@@ -44,12 +44,12 @@ void TaskAddHyperplanes::run()
     {
         int addedHyperplanes = 0;
 
-        for(auto k = env->dualSolver->hyperplaneWaitingList.size(); k > 0; k--)
+        for(auto k : selectHyperplanes())
         {
             if(addedHyperplanes >= env->settings->getSetting<int>("HyperplaneCuts.MaxPerIteration", "Dual"))
                 break;
 
-            auto tmpItem = env->dualSolver->hyperplaneWaitingList.at(k - 1);
+            auto tmpItem = env->dualSolver->hyperplaneWaitingList.at(k);
 
             bool cutAddedSuccessfully = false;
 
@@ -91,6 +91,170 @@ void TaskAddHyperplanes::run()
     env->timing->stopTimer("DualStrategy");
 }
 
+std::vector<int> TaskAddHyperplanes::selectHyperplanes()
+{
+    auto& waitingList = env->dualSolver->hyperplaneWaitingList;
+    std::vector<int> selectedHyperplanes;
+
+    std::vector<SolutionPoint> solutionPoints;
+
+    if(env->results->getNumberOfIterations() > 1)
+        solutionPoints = env->results->getPreviousIteration()->solutionPoints;
+
+    if(!env->settings->getSetting<bool>("HyperplaneCuts.Selection.Use", "Dual") || solutionPoints.size() == 0
+        || waitingList.size() < 2)
+    {
+        // The most recently generated hyperplanes are added first
+        for(int k = waitingList.size() - 1; k >= 0; k--)
+            selectedHyperplanes.push_back(k);
+
+        return (selectedHyperplanes);
+    }
+
+    double maxParallelism = env->settings->getSetting<double>("HyperplaneCuts.Selection.MaxParallelism", "Dual");
+    int maxHyperplanes = env->settings->getSetting<int>("HyperplaneCuts.MaxPerIteration", "Dual");
+
+    struct CutCandidate
+    {
+        int index;
+        std::map<int, double> coefficients; // Normalized to unit length
+        double constant;                    // Normalized with the same factor
+        double efficacy;                    // The largest distance to a solution point cut away
+    };
+
+    std::vector<CutCandidate> candidates;
+    std::vector<int> exemptHyperplanes;
+
+    for(int k = waitingList.size() - 1; k >= 0; k--)
+    {
+        auto& hyperplane = waitingList.at(k);
+
+        // Objective cuts are always added since these are needed for the dual bound
+        if(hyperplane.isObjectiveHyperplane || hyperplane.source == E_HyperplaneSource::ObjectiveRootsearch
+            || hyperplane.source == E_HyperplaneSource::ObjectiveCuttingPlane
+            || hyperplane.source == E_HyperplaneSource::PrimalSolutionSearchInteriorObjective)
+        {
+            exemptHyperplanes.push_back(k);
+            continue;
+        }
+
+        // The terms are stored in the hyperplane so that they are not calculated again when the cut is created
+        if(!hyperplane.terms)
+            hyperplane.terms = env->dualSolver->MIPSolver->createHyperplaneTerms(hyperplane);
+
+        if(!hyperplane.terms)
+        {
+            // Will be handled, i.e. rejected, when creating the hyperplane
+            exemptHyperplanes.push_back(k);
+            continue;
+        }
+
+        auto cut = normalizeCut(*hyperplane.terms);
+
+        if(!cut)
+        {
+            exemptHyperplanes.push_back(k);
+            continue;
+        }
+
+        CutCandidate candidate;
+        candidate.index = k;
+        candidate.coefficients = std::move(cut->first);
+        candidate.constant = cut->second;
+        candidate.efficacy = SHOT_DBL_MIN;
+
+        for(auto& SP : solutionPoints)
+        {
+            double value = candidate.constant;
+
+            for(auto& T : candidate.coefficients)
+            {
+                if(T.first < (int)SP.point.size())
+                    value += T.second * SP.point[T.first];
+            }
+
+            candidate.efficacy = std::max(candidate.efficacy, value);
+        }
+
+        candidates.push_back(std::move(candidate));
+    }
+
+    // Cosine of the angle between two cuts with normalized coefficients. Cuts in opposite directions are not parallel
+    // in this sense, since they bound the feasible set from different sides.
+    auto calculateParallelism = [](const std::map<int, double>& first, const std::map<int, double>& second) {
+        const auto& shortest = (first.size() < second.size()) ? first : second;
+        const auto& longest = (first.size() < second.size()) ? second : first;
+
+        double product = 0.0;
+
+        for(auto& T : shortest)
+        {
+            if(auto element = longest.find(T.first); element != longest.end())
+                product += T.second * element->second;
+        }
+
+        return (product);
+    };
+
+    // The candidates are only compared with each other and not with the cuts already in the MIP problem. These are
+    // fulfilled in the solution points, so a parallel candidate cutting away a solution point is always tighter.
+
+    // Stable sort so that the most recent hyperplane is selected among equally efficient ones
+    std::stable_sort(candidates.begin(), candidates.end(),
+        [](const CutCandidate& first, const CutCandidate& second) { return (first.efficacy > second.efficacy); });
+
+    selectedHyperplanes = exemptHyperplanes;
+    std::vector<const CutCandidate*> selectedCuts;
+    int numberOfParallel = 0;
+
+    for(auto& C : candidates)
+    {
+        if((int)selectedHyperplanes.size() >= maxHyperplanes)
+            break;
+
+        // A more efficient cut that is almost parallel has already been selected
+        if(std::any_of(selectedCuts.begin(), selectedCuts.end(), [&](const auto& selected) {
+               return (calculateParallelism(C.coefficients, selected->coefficients) > maxParallelism);
+           }))
+        {
+            numberOfParallel++;
+            continue;
+        }
+
+        selectedHyperplanes.push_back(C.index);
+        selectedCuts.push_back(&C);
+    }
+
+    if(numberOfParallel > 0)
+    {
+        env->output->outputDebug(
+            fmt::format("        Cut selection removed {} almost parallel cuts.", numberOfParallel));
+    }
+
+    return (selectedHyperplanes);
+}
+
+std::optional<std::pair<std::map<int, double>, double>> TaskAddHyperplanes::normalizeCut(
+    const std::pair<std::map<int, double>, double>& cut)
+{
+    double norm = 0.0;
+
+    for(auto& T : cut.first)
+        norm += T.second * T.second;
+
+    norm = std::sqrt(norm);
+
+    if(!(norm > 0.0) || !std::isfinite(norm))
+        return (std::nullopt);
+
+    std::map<int, double> coefficients;
+
+    for(auto& T : cut.first)
+        coefficients.emplace(T.first, T.second / norm);
+
+    return (std::make_pair(coefficients, cut.second / norm));
+}
+
 std::string TaskAddHyperplanes::getType()
 {
     std::string type = typeid(this).name();
@@ -11,6 +11,11 @@
 #pragma once
 #include "TaskBase.h"
 
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
 namespace SHOT
 {
 class TaskAddHyperplanes : public TaskBase
@@ -23,7 +28,14 @@ public:
 
     std::string getType() override;
 
+    // Returns the indexes of the hyperplanes in the waiting list to add, in the order they should be added
+    std::vector<int> selectHyperplanes();
+
 private:
     int itersWithoutAddedHPs;
+
+    // Returns the cut scaled so that the coefficients have unit length, or an empty optional if all are zero
+    static std::optional<std::pair<std::map<int, double>, double>> normalizeCut(
+        const std::pair<std::map<int, double>, double>& cut);
 };
 } // namespace SHOT
\ No newline at end of file
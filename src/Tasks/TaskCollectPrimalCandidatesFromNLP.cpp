@@ -0,0 +1,46 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "TaskCollectPrimalCandidatesFromNLP.h"
+
+#include "TaskSelectPrimalCandidatesFromNLP.h"
+
+namespace SHOT
+{
+
+TaskCollectPrimalCandidatesFromNLP::TaskCollectPrimalCandidatesFromNLP(EnvironmentPtr envPtr, bool waitForCompletion)
+    : TaskBase(envPtr), waitForCompletion(waitForCompletion)
+{
+}
+
+TaskCollectPrimalCandidatesFromNLP::~TaskCollectPrimalCandidatesFromNLP() = default;
+
+void TaskCollectPrimalCandidatesFromNLP::addTask(std::shared_ptr<TaskSelectPrimalCandidatesFromNLP> task)
+{
+    tasks.push_back(task);
+}
+
+void TaskCollectPrimalCandidatesFromNLP::run()
+{
+    for(auto& T : tasks)
+    {
+        if(waitForCompletion)
+            T->stopAsynchronousSolving();
+        else
+            T->collectAsynchronousSolutions(false);
+    }
+}
+
+std::string TaskCollectPrimalCandidatesFromNLP::getType()
+{
+    std::string type = typeid(this).name();
+    return (type);
+}
+} // namespace SHOT
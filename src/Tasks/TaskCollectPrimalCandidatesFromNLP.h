@@ -0,0 +1,39 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+#include "TaskBase.h"
+
+#include <memory>
+#include <vector>
+
+namespace SHOT
+{
+class TaskSelectPrimalCandidatesFromNLP;
+
+// Processes the solutions to the fixed NLP problems solved asynchronously by the given tasks, so that new primal
+// solutions are used for the cutoff and as MIP starts as soon as possible. If waitForCompletion is true, the task waits
+// for the problems being solved and the following fixed NLP problems are solved synchronously.
+class TaskCollectPrimalCandidatesFromNLP : public TaskBase
+{
+public:
+    TaskCollectPrimalCandidatesFromNLP(EnvironmentPtr envPtr, bool waitForCompletion);
+    ~TaskCollectPrimalCandidatesFromNLP() override;
+
+    void addTask(std::shared_ptr<TaskSelectPrimalCandidatesFromNLP> task);
+
+    void run() override;
+    std::string getType() override;
+
+private:
+    std::vector<std::shared_ptr<TaskSelectPrimalCandidatesFromNLP>> tasks;
+    bool waitForCompletion;
+};
+} // namespace SHOT
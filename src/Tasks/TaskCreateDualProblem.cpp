@@ -72,6 +72,9 @@ void TaskCreateDualProblem::run()
 
 bool TaskCreateDualProblem::createProblem(MIPSolverPtr destination, ProblemPtr sourceProblem)
 {
+    // The names are not needed by the MIP solvers, and skipping them saves memory and time on large problems
+    bool useNames = env->settings->getSetting<bool>("MIP.UseNames", "Dual");
+
     // Now creating the variables
 
     bool variablesInitialized = true;
@@ -79,7 +82,8 @@ bool TaskCreateDualProblem::createProblem(MIPSolverPtr destination, ProblemPtr s
     for(auto& V : sourceProblem->allVariables)
     {
         variablesInitialized = variablesInitialized
-            && destination->addVariable(V->name.c_str(), V->properties.type, V->lowerBound, V->upperBound, V->semiBound);
+            && destination->addVariable(
+                useNames ? V->name : "", V->properties.type, V->lowerBound, V->upperBound, V->semiBound);
     }
 
     if(!variablesInitialized)
@@ -174,7 +178,8 @@ bool TaskCreateDualProblem::createProblem(MIPSolverPtr destination, ProblemPtr s
         }
 
         constraintsInitialized
-            = constraintsInitialized && destination->finalizeConstraint(C->name, C->valueLHS, C->valueRHS, C->constant);
+            = constraintsInitialized
+            && destination->finalizeConstraint(useNames ? C->name : "", C->valueLHS, C->valueRHS, C->constant);
     }
 
     for(auto& C : sourceProblem->quadraticConstraints)
@@ -201,7 +206,8 @@ bool TaskCreateDualProblem::createProblem(MIPSolverPtr destination, ProblemPtr s
         }
 
         constraintsInitialized
-            = constraintsInitialized && destination->finalizeConstraint(C->name, C->valueLHS, C->valueRHS, C->constant);
+            = constraintsInitialized
+            && destination->finalizeConstraint(useNames ? C->name : "", C->valueLHS, C->valueRHS, C->constant);
     }
 
     if(!constraintsInitialized)
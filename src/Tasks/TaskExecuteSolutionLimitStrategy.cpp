@@ -25,6 +25,7 @@
 #include "../MIPSolver/MIPSolutionLimitStrategyUnlimited.h"
 #include "../MIPSolver/MIPSolutionLimitStrategyIncrease.h"
 #include "../MIPSolver/MIPSolutionLimitStrategyAdaptive.h"
+#include "../MIPSolver/MIPSolutionLimitStrategyGapAndTimeBudget.h"
 
 namespace SHOT
 {
@@ -36,7 +37,23 @@ TaskExecuteSolutionLimitStrategy::TaskExecuteSolutionLimitStrategy(EnvironmentPt
     isInitialized = false;
     temporaryOptLimitUsed = false;
 
-    solutionLimitStrategy = std::make_unique<MIPSolutionLimitStrategyIncrease>(env);
+    switch(static_cast<ES_MIPSolutionLimitStrategy>(
+        env->settings->getSetting<int>("MIP.SolutionLimit.Strategy", "Dual")))
+    {
+    case ES_MIPSolutionLimitStrategy::Adaptive:
+        solutionLimitStrategy = std::make_unique<MIPSolutionLimitStrategyAdaptive>(env);
+        break;
+    case ES_MIPSolutionLimitStrategy::Unlimited:
+        solutionLimitStrategy = std::make_unique<MIPSolutionLimitStrategyUnlimited>(env);
+        break;
+    case ES_MIPSolutionLimitStrategy::GapAndTimeBudget:
+        solutionLimitStrategy = std::make_unique<MIPSolutionLimitStrategyGapAndTimeBudget>(env);
+        break;
+    default:
+        solutionLimitStrategy = std::make_unique<MIPSolutionLimitStrategyIncrease>(env);
+        break;
+    }
+
     auto initLim = solutionLimitStrategy->getInitialLimit();
     env->dualSolver->MIPSolver->setSolutionLimit(initLim);
     previousSolLimit = initLim;
@@ -57,6 +74,8 @@ void TaskExecuteSolutionLimitStrategy::run()
     auto currIter = env->results->getCurrentIteration();
     auto prevIter = env->results->getPreviousIteration();
 
+    solutionLimitStrategy->updateIterationLimits();
+
     if(env->reformulatedProblem->properties.convexity != E_ProblemConvexity::Convex)
     {
         if(temporaryOptLimitUsed)
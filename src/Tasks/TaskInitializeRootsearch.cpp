@@ -10,9 +10,12 @@
 
 #include "TaskInitializeRootsearch.h"
 
+#include "../Settings.h"
 #include "../Timing.h"
 
 #include "../RootsearchMethod/RootsearchMethodBoost.h"
+#include "../RootsearchMethod/RootsearchMethodKarySection.h"
+#include "../RootsearchMethod/RootsearchMethodNewton.h"
 
 namespace SHOT
 {
@@ -21,7 +24,21 @@ TaskInitializeRootsearch::TaskInitializeRootsearch(EnvironmentPtr envPtr) : Task
 {
     env->timing->startTimer("DualCutGenerationRootSearch");
 
-    env->rootsearchMethod = std::dynamic_pointer_cast<IRootsearchMethod>(std::make_shared<RootsearchMethodBoost>(env));
+    switch(static_cast<ES_RootsearchMethod>(env->settings->getSetting<int>("Rootsearch.Method", "Subsolver")))
+    {
+    case ES_RootsearchMethod::SafeguardedNewton:
+        env->rootsearchMethod
+            = std::dynamic_pointer_cast<IRootsearchMethod>(std::make_shared<RootsearchMethodNewton>(env));
+        break;
+    case ES_RootsearchMethod::KarySection:
+        env->rootsearchMethod
+            = std::dynamic_pointer_cast<IRootsearchMethod>(std::make_shared<RootsearchMethodKarySection>(env));
+        break;
+    default:
+        env->rootsearchMethod
+            = std::dynamic_pointer_cast<IRootsearchMethod>(std::make_shared<RootsearchMethodBoost>(env));
+        break;
+    }
 
     env->timing->stopTimer("DualCutGenerationRootSearch");
 }
@@ -18,6 +18,7 @@
 #include "../Results.h"
 #include "../Settings.h"
 #include "../Solver.h"
+#include "../TaskHandler.h"
 #include "../Timing.h"
 #include "../Utilities.h"
 
@@ -58,8 +59,7 @@ TaskPerformBoundTightening::TaskPerformBoundTightening(EnvironmentPtr envPtr, Pr
         POASolver->solver->updateSetting("DualStagnation.IterationLimit", "Termination",
             env->settings->getSetting<int>("BoundTightening.InitialPOA.StagnationIterationLimit", "Model"));
 
-        POASolver->solver->updateSetting("TimeLimit", "Termination",
-            env->settings->getSetting<double>("BoundTightening.InitialPOA.TimeLimit", "Model"));
+        POASolver->timeLimit = env->settings->getSetting<double>("BoundTightening.InitialPOA.TimeLimit", "Model");
 
         POASolver->solver->updateSetting("IterationLimit", "Termination",
             env->settings->getSetting<int>("BoundTightening.InitialPOA.IterationLimit", "Model"));
@@ -85,6 +85,10 @@ TaskPerformBoundTightening::~TaskPerformBoundTightening() = default;
 
 void TaskPerformBoundTightening::run()
 {
+    // The bounds are only tightened to speed up the solution process, so it is skipped if there is no time left
+    if(env->tasks->isCancelled())
+        return;
+
     env->timing->startTimer("BoundTightening");
 
     if(env->settings->getSetting<bool>("BoundTightening.InitialPOA.Use", "Model")
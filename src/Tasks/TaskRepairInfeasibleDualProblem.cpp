@@ -97,8 +97,8 @@ void TaskRepairInfeasibleDualProblem::run()
 
     currIter->hasInfeasibilityRepairBeenPerformed = true;
 
-    env->dualSolver->MIPSolver->setTimeLimit(
-        env->settings->getSetting<double>("MIP.InfeasibilityRepair.TimeLimit", "Dual"));
+    env->dualSolver->MIPSolver->setTimeLimit(std::min(env->tasks->getRemainingTime(),
+        env->settings->getSetting<double>("MIP.InfeasibilityRepair.TimeLimit", "Dual")));
 
     // Otherwise repair problem might not be solved to optimality
     env->dualSolver->MIPSolver->setSolutionLimit(2100000000);
@@ -12,6 +12,7 @@
 #include "../DualSolver.h"
 #include "../MIPSolver/IMIPSolver.h"
 #include "../Output.h"
+#include "../PrimalSolver.h"
 #include "../Results.h"
 #include "../Settings.h"
 #include "../Utilities.h"
@@ -33,6 +34,11 @@ TaskSelectHyperplanePointsECP::~TaskSelectHyperplanePointsECP() = default;
 void TaskSelectHyperplanePointsECP::run() { this->run(env->results->getPreviousIteration()->solutionPoints); }
 
 void TaskSelectHyperplanePointsECP::run(std::vector<SolutionPoint> solPoints)
+{
+    this->run(solPoints, env->results->getCurrentIteration()); // The unsolved new iteration
+}
+
+void TaskSelectHyperplanePointsECP::run(std::vector<SolutionPoint> solPoints, IterationPtr currIter)
 {
     if(env->reformulatedProblem->properties.numberOfNonlinearConstraints == 0)
         return;
@@ -42,7 +48,6 @@ void TaskSelectHyperplanePointsECP::run(std::vector<SolutionPoint> solPoints)
     env->timing->startTimer("DualCutGenerationRootSearch");
 
     int addedHyperplanes = 0;
-    auto currIter = env->results->getCurrentIteration(); // The unsolved new iteration
 
     auto constraintSelectionFactor
         = env->settings->getSetting<double>("HyperplaneCuts.ConstraintSelectionFactor", "Dual");
@@ -154,6 +159,13 @@ void TaskSelectHyperplanePointsECP::run(std::vector<SolutionPoint> solPoints)
         env->output->outputDebug("         Could not add hyperplane for convex constraints, number of nonconvex: "
             + std::to_string(nonconvexSelectedNumericValues.size()));
 
+        std::vector<PrimalSolution> primalSolutions;
+
+        {
+            std::lock_guard<std::recursive_mutex> lock(env->primalSolver->primalSolutionMutex);
+            primalSolutions = env->results->primalSolutions;
+        }
+
         for(auto& values : nonconvexSelectedNumericValues)
         {
             if(addedHyperplanes > maxHyperplanesPerIter)
@@ -187,7 +199,7 @@ void TaskSelectHyperplanePointsECP::run(std::vector<SolutionPoint> solPoints)
 
             bool cutsAwayPrimalSolution = false;
 
-            for(auto& P : env->results->primalSolutions)
+            for(auto& P : primalSolutions)
             {
                 if(auto terms = env->dualSolver->MIPSolver->createHyperplaneTerms(hyperplane))
                 {
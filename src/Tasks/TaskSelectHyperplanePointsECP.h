@@ -24,6 +24,10 @@ public:
     void run() override;
     virtual void run(std::vector<SolutionPoint> solPoints);
 
+    // Uses the given iteration instead of the current one in the results, so that the task can be run without
+    // locking the results
+    virtual void run(std::vector<SolutionPoint> solPoints, IterationPtr currIter);
+
     std::string getType() override;
 
 private:
@@ -13,6 +13,7 @@
 #include "../DualSolver.h"
 #include "../MIPSolver/IMIPSolver.h"
 #include "../Output.h"
+#include "../PrimalSolver.h"
 #include "../Results.h"
 #include "../Settings.h"
 #include "../Utilities.h"
@@ -32,11 +33,24 @@ TaskSelectHyperplanePointsESH::TaskSelectHyperplanePointsESH(EnvironmentPtr envP
     env->timing->stopTimer("DualCutGenerationRootSearch");
 }
 
+TaskSelectHyperplanePointsESH::TaskSelectHyperplanePointsESH(
+    EnvironmentPtr envPtr, std::shared_ptr<IRootsearchMethod> rootsearchMethod)
+    : TaskBase(envPtr), rootsearchMethod(rootsearchMethod)
+{
+    env->timing->startTimer("DualCutGenerationRootSearch");
+    env->timing->stopTimer("DualCutGenerationRootSearch");
+}
+
 TaskSelectHyperplanePointsESH::~TaskSelectHyperplanePointsESH() = default;
 
 void TaskSelectHyperplanePointsESH::run() { this->run(env->results->getPreviousIteration()->solutionPoints); }
 
 void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
+{
+    this->run(solPoints, env->results->getCurrentIteration()); // The unsolved new iteration
+}
+
+void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints, IterationPtr currIter)
 {
     if(env->reformulatedProblem->properties.numberOfNonlinearConstraints == 0)
         return;
@@ -45,13 +59,16 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
 
     env->timing->startTimer("DualCutGenerationRootSearch");
 
-    if(env->dualSolver->interiorPts.size() == 0)
+    auto interiorPts = env->dualSolver->getInteriorPoints();
+    auto rootsearch = (rootsearchMethod) ? rootsearchMethod : env->rootsearchMethod;
+
+    if(interiorPts.size() == 0)
     {
         if(!tSelectHPPts)
             tSelectHPPts = std::make_unique<TaskSelectHyperplanePointsECP>(env);
 
         env->output->outputDebug("         Adding cutting plane since no interior point is known.");
-        tSelectHPPts->run(solPoints);
+        tSelectHPPts->run(solPoints, currIter);
 
         env->timing->stopTimer("DualCutGenerationRootSearch");
         return;
@@ -63,14 +80,13 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
             tSelectHPPts = std::make_unique<TaskSelectHyperplanePointsECP>(env);
 
         env->output->outputDebug("         Adding cutting plane since the dual has stagnated.");
-        tSelectHPPts->run(solPoints);
+        tSelectHPPts->run(solPoints, currIter);
 
         env->timing->stopTimer("DualCutGenerationRootSearch");
         return;
     }
 
     int addedHyperplanes = 0;
-    auto currIter = env->results->getCurrentIteration(); // The unsolved new iteration
 
     auto constraintSelectionFactor
         = env->settings->getSetting<double>("HyperplaneCuts.ConstraintSelectionFactor", "Dual");
@@ -116,7 +132,7 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
 
         if(useMaxFunction)
         {
-            for(size_t j = 0; j < env->dualSolver->interiorPts.size(); j++)
+            for(size_t j = 0; j < interiorPts.size(); j++)
             {
                 auto numericConstraintValuesConvex = NumericConstraintValues();
                 auto numericConstraintValuesAll = NumericConstraintValues();
@@ -152,7 +168,7 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
         }
         else
         {
-            for(size_t j = 0; j < env->dualSolver->interiorPts.size(); j++)
+            for(size_t j = 0; j < interiorPts.size(); j++)
             {
                 for(auto& NCV : numericConstraintValues)
                 {
@@ -224,7 +240,7 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
             try
             {
                 env->timing->startTimer("DualCutGenerationRootSearch");
-                auto xNewc = env->rootsearchMethod->findZero(env->dualSolver->interiorPts.at(interiorPtIndex)->point,
+                auto xNewc = rootsearch->findZero(interiorPts.at(interiorPtIndex)->point,
                     solPoints.at(solutionPtIndex).point, rootMaxIter, rootTerminationTolerance,
                     rootActiveConstraintTolerance, currentConstraints, true);
 
@@ -242,7 +258,7 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
             }
 
             auto externalConstraintValue = env->reformulatedProblem->getMaxNumericConstraintValue(
-                externalPoint, env->reformulatedProblem->nonlinearConstraints, 0.0);
+                externalPoint, env->reformulatedProblem->nonredundantNonlinearConstraints, 0.0);
 
             if(externalConstraintValue.normalizedValue >= 0)
             {
@@ -312,8 +328,8 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
                 try
                 {
                     env->timing->startTimer("DualCutGenerationRootSearch");
-                    auto xNewc = env->rootsearchMethod->findZero(
-                        env->dualSolver->interiorPts.at(interiorPtIndex)->point, solPoints.at(solutionPtIndex).point,
+                    auto xNewc = rootsearch->findZero(
+                        interiorPts.at(interiorPtIndex)->point, solPoints.at(solutionPtIndex).point,
                         rootMaxIter, rootTerminationTolerance, rootActiveConstraintTolerance, currentConstraint, true);
 
                     env->timing->stopTimer("DualCutGenerationRootSearch");
@@ -395,6 +411,13 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
     {
         env->output->outputDebug("         Could not add hyperplane for convex constraints");
 
+        std::vector<PrimalSolution> primalSolutions;
+
+        {
+            std::lock_guard<std::recursive_mutex> lock(env->primalSolver->primalSolutionMutex);
+            primalSolutions = env->results->primalSolutions;
+        }
+
         for(auto& values : nonconvexSelectedNumericValues)
         {
             int solutionPtIndex = std::get<0>(values);
@@ -416,8 +439,8 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
                 try
                 {
                     env->timing->startTimer("DualCutGenerationRootSearch");
-                    auto xNewc = env->rootsearchMethod->findZero(
-                        env->dualSolver->interiorPts.at(interiorPtIndex)->point, solPoints.at(solutionPtIndex).point,
+                    auto xNewc = rootsearch->findZero(
+                        interiorPts.at(interiorPtIndex)->point, solPoints.at(solutionPtIndex).point,
                         rootMaxIter, rootTerminationTolerance, rootActiveConstraintTolerance, currentConstraints, true);
 
                     env->timing->stopTimer("DualCutGenerationRootSearch");
@@ -434,7 +457,7 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
                 }
 
                 auto externalConstraintValue = env->reformulatedProblem->getMaxNumericConstraintValue(
-                    externalPoint, env->reformulatedProblem->nonlinearConstraints, 0.0);
+                    externalPoint, env->reformulatedProblem->nonredundantNonlinearConstraints, 0.0);
 
                 if(externalConstraintValue.normalizedValue >= 0)
                 {
@@ -477,7 +500,7 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
 
                     bool cutsAwayPrimalSolution = false;
 
-                    for(auto& P : env->results->primalSolutions)
+                    for(auto& P : primalSolutions)
                     {
                         if(auto terms = env->dualSolver->MIPSolver->createHyperplaneTerms(hyperplane))
                         {
@@ -532,7 +555,7 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
                     {
                         env->timing->startTimer("DualCutGenerationRootSearch");
                         auto xNewc
-                            = env->rootsearchMethod->findZero(env->dualSolver->interiorPts.at(interiorPtIndex)->point,
+                            = rootsearch->findZero(interiorPts.at(interiorPtIndex)->point,
                                 solPoints.at(solutionPtIndex).point, rootMaxIter, rootTerminationTolerance,
                                 rootActiveConstraintTolerance, currentConstraint, true);
 
@@ -591,7 +614,7 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
 
                         bool cutsAwayPrimalSolution = false;
 
-                        for(auto& P : env->results->primalSolutions)
+                        for(auto& P : primalSolutions)
                         {
                             if(auto terms = env->dualSolver->MIPSolver->createHyperplaneTerms(hyperplane))
                             {
@@ -639,7 +662,7 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
 
         for(auto& HP : hyperplanesCuttingAwayPrimals)
         {
-            double hash = Utilities::calculateHash(HP.first.generatedPoint);
+            double hash = Utilities::calculateHash(HP.first.generatedPoint.get());
 
             if(env->dualSolver->hasHyperplaneBeenAdded(hash, HP.first.sourceConstraintIndex))
             {
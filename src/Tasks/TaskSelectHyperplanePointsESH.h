@@ -15,21 +15,31 @@ namespace SHOT
 {
 
 class Constraint;
+class IRootsearchMethod;
 class TaskSelectHyperplanePointsECP;
 
 class TaskSelectHyperplanePointsESH : public TaskBase
 {
 public:
     TaskSelectHyperplanePointsESH(EnvironmentPtr envPtr);
+
+    // Uses its own root search method instead of the shared one, so that the task can be run in parallel with other
+    // instances, e.g., in different threads of a MIP solver callback
+    TaskSelectHyperplanePointsESH(EnvironmentPtr envPtr, std::shared_ptr<IRootsearchMethod> rootsearchMethod);
     ~TaskSelectHyperplanePointsESH() override;
 
     void run() override;
     virtual void run(std::vector<SolutionPoint> solPoints);
 
+    // Uses the given iteration instead of the current one in the results, so that the task can be run without
+    // locking the results, e.g., in a MIP solver callback while another thread creates a new iteration
+    virtual void run(std::vector<SolutionPoint> solPoints, IterationPtr currIter);
+
     std::string getType() override;
 
 private:
     std::unique_ptr<TaskSelectHyperplanePointsECP> tSelectHPPts;
     std::vector<Constraint*> nonlinearConstraints;
+    std::shared_ptr<IRootsearchMethod> rootsearchMethod;
 };
 } // namespace SHOT
\ No newline at end of file
@@ -0,0 +1,119 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "TaskSelectHyperplanePointsMcCormick.h"
+
+#include "../DualSolver.h"
+#include "../Output.h"
+#include "../Results.h"
+#include "../Settings.h"
+#include "../Timing.h"
+
+#include "../Model/McCormickRelaxations.h"
+#include "../Model/Problem.h"
+
+#include "spdlog/fmt/fmt.h"
+
+#include <map>
+
+namespace SHOT
+{
+
+TaskSelectHyperplanePointsMcCormick::TaskSelectHyperplanePointsMcCormick(EnvironmentPtr envPtr) : TaskBase(envPtr)
+{
+    env->timing->startTimer("DualCutGenerationMcCormick");
+    env->timing->stopTimer("DualCutGenerationMcCormick");
+}
+
+TaskSelectHyperplanePointsMcCormick::~TaskSelectHyperplanePointsMcCormick() = default;
+
+void TaskSelectHyperplanePointsMcCormick::run() { this->run(env->results->getPreviousIteration()->solutionPoints); }
+
+void TaskSelectHyperplanePointsMcCormick::run(std::vector<SolutionPoint> solPoints)
+{
+    if(env->reformulatedProblem->properties.numberOfNonlinearConstraints == 0)
+        return;
+
+    env->timing->startTimer("DualCutGenerationMcCormick");
+
+    int addedHyperplanes = 0;
+    int maxHyperplanesPerIter = env->settings->getSetting<int>("HyperplaneCuts.MaxPerIteration", "Dual");
+    double constraintTolerance = env->settings->getSetting<double>("ConstraintTolerance", "Termination");
+
+    McCormickRelaxations relaxations(env);
+
+    for(auto& SP : solPoints)
+    {
+        auto numericConstraintValues = env->reformulatedProblem->getFractionOfDeviatingNonlinearConstraints(
+            SP.point, constraintTolerance, 1.0);
+
+        for(auto& NCV : numericConstraintValues)
+        {
+            if(addedHyperplanes >= maxHyperplanesPerIter)
+                break;
+
+            // The supporting hyperplanes of the convex constraints are already valid
+            if(NCV.constraint->properties.convexity <= E_Convexity::Convex || std::isnan(NCV.error))
+                continue;
+
+            // A violated lower bound is cut with the concave overestimator, and an upper bound with the convex
+            // underestimator, of the constraint function
+            bool isLHSViolated = NCV.isFulfilledRHS && !NCV.isFulfilledLHS;
+
+            auto linearization = relaxations.calculateLinearization(NCV.constraint, SP.point, isLHSViolated);
+
+            if(!linearization || linearization->first.size() == 0)
+                continue;
+
+            // The cut is on the form sum(a_i*x_i) + constant <= 0
+            double signFactor = isLHSViolated ? -1.0 : 1.0;
+            std::map<int, double> elements;
+
+            for(auto& [I, C] : linearization->first)
+                elements.emplace(I, signFactor * C);
+
+            double constant = isLHSViolated ? NCV.constraint->valueLHS - linearization->second
+                                            : linearization->second - NCV.constraint->valueRHS;
+
+            // The cut only removes the point if the relaxation, and not only the constraint, is violated in it
+            double relaxationError = constant;
+
+            for(auto& [I, C] : elements)
+                relaxationError += C * SP.point.at(I);
+
+            if(!(relaxationError > constraintTolerance))
+                continue;
+
+            Hyperplane hyperplane;
+            hyperplane.sourceConstraint = NCV.constraint;
+            hyperplane.sourceConstraintIndex = NCV.constraint->index;
+            hyperplane.generatedPoint = SP.point;
+            hyperplane.source = E_HyperplaneSource::McCormickRelaxation;
+            hyperplane.isSourceConvex = true; // The relaxation underestimates the constraint everywhere
+            hyperplane.terms = std::make_pair(std::move(elements), constant);
+
+            env->dualSolver->addHyperplane(hyperplane);
+            addedHyperplanes++;
+
+            env->output->outputDebug(
+                fmt::format("         Added McCormick cut for constraint {} to waiting list with deviation {}",
+                    NCV.constraint->name, relaxationError));
+        }
+    }
+
+    env->timing->stopTimer("DualCutGenerationMcCormick");
+}
+
+std::string TaskSelectHyperplanePointsMcCormick::getType()
+{
+    std::string type = typeid(this).name();
+    return (type);
+}
+} // namespace SHOT
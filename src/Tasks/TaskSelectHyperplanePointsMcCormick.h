@@ -0,0 +1,34 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+#include "TaskBase.h"
+
+#include "../Structs.h"
+
+#include <vector>
+
+namespace SHOT
+{
+// Adds cuts from the linearizations of the McCormick relaxations of the nonconvex constraints violated in the solution
+// points. These are valid for the whole problem, unlike the supporting hyperplanes of the nonconvex constraints, and
+// thus tighten the dual bound.
+class TaskSelectHyperplanePointsMcCormick : public TaskBase
+{
+public:
+    TaskSelectHyperplanePointsMcCormick(EnvironmentPtr envPtr);
+    ~TaskSelectHyperplanePointsMcCormick() override;
+
+    void run() override;
+    virtual void run(std::vector<SolutionPoint> solPoints);
+
+    std::string getType() override;
+};
+} // namespace SHOT
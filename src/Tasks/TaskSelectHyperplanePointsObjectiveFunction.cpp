@@ -29,6 +29,12 @@ TaskSelectHyperplanePointsObjectiveFunction::TaskSelectHyperplanePointsObjective
 {
 }
 
+TaskSelectHyperplanePointsObjectiveFunction::TaskSelectHyperplanePointsObjectiveFunction(
+    EnvironmentPtr envPtr, std::shared_ptr<IRootsearchMethod> rootsearchMethod)
+    : TaskBase(envPtr), rootsearchMethod(rootsearchMethod)
+{
+}
+
 TaskSelectHyperplanePointsObjectiveFunction::~TaskSelectHyperplanePointsObjectiveFunction() = default;
 
 void TaskSelectHyperplanePointsObjectiveFunction::run()
@@ -37,6 +43,11 @@ void TaskSelectHyperplanePointsObjectiveFunction::run()
 }
 
 void TaskSelectHyperplanePointsObjectiveFunction::run(std::vector<SolutionPoint> sourcePoints)
+{
+    this->run(sourcePoints, env->results->getCurrentIteration());
+}
+
+void TaskSelectHyperplanePointsObjectiveFunction::run(std::vector<SolutionPoint> sourcePoints, IterationPtr currIter)
 {
     if(sourcePoints.size() == 0)
         return;
@@ -68,7 +79,7 @@ void TaskSelectHyperplanePointsObjectiveFunction::run(std::vector<SolutionPoint>
             || (env->reformulatedProblem->objectiveFunction->properties.isMaximize
                 && env->reformulatedProblem->objectiveFunction->properties.convexity == E_Convexity::Concave));
 
-    if(!isConvex && (env->results->getCurrentIteration()->numHyperplanesAdded > 0 || numHyperplaneAdded > 0))
+    if(!isConvex && (currIter->numHyperplanesAdded > 0 || numHyperplaneAdded > 0))
     {
         // Nonconvex objective function, do not add a cut if not necessary
         env->output->outputDebug("         No need to add cut to nonconvex objective function.");
@@ -90,6 +101,8 @@ void TaskSelectHyperplanePointsObjectiveFunction::run(std::vector<SolutionPoint>
         && env->reformulatedProblem->properties.convexity > E_ProblemConvexity::Convex)
         useRootsearch = false;
 
+    auto rootsearch = (rootsearchMethod) ? rootsearchMethod : env->rootsearchMethod;
+
     for(auto& SOLPT : sourcePoints)
     {
         if(useRootsearch)
@@ -100,9 +113,7 @@ void TaskSelectHyperplanePointsObjectiveFunction::run(std::vector<SolutionPoint>
 
             double factor = std::min(0.01, 1 / std::abs(SOLPT.objectiveValue));
             double objectiveLB = SOLPT.objectiveValue;
-            double objectiveUB = (exactValue < 0)
-                ? (1 - factor) * env->reformulatedProblem->objectiveFunction->calculateValue(SOLPT.point)
-                : (1 + factor) * env->reformulatedProblem->objectiveFunction->calculateValue(SOLPT.point);
+            double objectiveUB = (exactValue < 0) ? (1 - factor) * exactValue : (1 + factor) * exactValue;
 
             try
             {
@@ -110,14 +121,14 @@ void TaskSelectHyperplanePointsObjectiveFunction::run(std::vector<SolutionPoint>
 
                 if(env->reformulatedProblem->objectiveFunction->properties.isMinimize)
                 {
-                    rootBound = env->rootsearchMethod->findZero(SOLPT.point, objectiveLB, objectiveUB,
+                    rootBound = rootsearch->findZero(SOLPT.point, objectiveLB, objectiveUB,
                         env->settings->getSetting<int>("Rootsearch.MaxIterations", "Subsolver"),
                         env->settings->getSetting<double>("Rootsearch.TerminationTolerance", "Subsolver"), 0,
                         env->reformulatedProblem->objectiveFunction);
                 }
                 else
                 {
-                    rootBound = env->rootsearchMethod->findZero(SOLPT.point, objectiveUB, objectiveLB,
+                    rootBound = rootsearch->findZero(SOLPT.point, objectiveUB, objectiveLB,
                         env->settings->getSetting<int>("Rootsearch.MaxIterations", "Subsolver"),
                         env->settings->getSetting<double>("Rootsearch.TerminationTolerance", "Subsolver"), 0,
                         env->reformulatedProblem->objectiveFunction);
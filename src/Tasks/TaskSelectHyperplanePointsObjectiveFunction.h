@@ -17,14 +17,28 @@
 
 namespace SHOT
 {
+class IRootsearchMethod;
+
 class TaskSelectHyperplanePointsObjectiveFunction : public TaskBase
 {
 public:
     TaskSelectHyperplanePointsObjectiveFunction(EnvironmentPtr envPtr);
+
+    // Uses its own root search method instead of the shared one, so that the task can be run in parallel with other
+    // instances
+    TaskSelectHyperplanePointsObjectiveFunction(
+        EnvironmentPtr envPtr, std::shared_ptr<IRootsearchMethod> rootsearchMethod);
     ~TaskSelectHyperplanePointsObjectiveFunction() override;
 
     void run() override;
     virtual void run(std::vector<SolutionPoint> solPoints);
+
+    // Uses the given iteration instead of the current one in the results, so that the task can be run without
+    // locking the results
+    virtual void run(std::vector<SolutionPoint> solPoints, IterationPtr currIter);
     std::string getType() override;
+
+private:
+    std::shared_ptr<IRootsearchMethod> rootsearchMethod;
 };
 } // namespace SHOT
\ No newline at end of file
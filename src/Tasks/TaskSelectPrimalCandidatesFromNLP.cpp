@@ -41,12 +41,17 @@
 namespace SHOT
 {
 
-TaskSelectPrimalCandidatesFromNLP::TaskSelectPrimalCandidatesFromNLP(EnvironmentPtr envPtr, bool useReformulatedProblem)
-    : TaskBase(envPtr)
+TaskSelectPrimalCandidatesFromNLP::TaskSelectPrimalCandidatesFromNLP(
+    EnvironmentPtr envPtr, bool useReformulatedProblem, bool runAsynchronously)
+    : TaskBase(envPtr), runAsynchronously(runAsynchronously)
 {
     env->timing->startTimer("PrimalStrategy");
     env->timing->startTimer("PrimalBoundStrategyNLP");
 
+    // The NLP problems are solved, and their functions evaluated, in another thread than the MIP problem
+    if(runAsynchronously)
+        Problem::shareFactorableFunctionsMutex();
+
     originalNLPTime = env->settings->getSetting<double>("FixedInteger.Frequency.Time", "Primal");
     originalNLPIter = env->settings->getSetting<int>("FixedInteger.Frequency.Iteration", "Primal");
 
@@ -119,6 +124,13 @@ TaskSelectPrimalCandidatesFromNLP::TaskSelectPrimalCandidatesFromNLP(Environment
 
     env->results->usedPrimalNLPSolverDescription = NLPSolver->getSolverDescription();
 
+    // The other NLP solvers use the environment or the modeling system, and cannot be run in a separate thread
+    if(this->runAsynchronously && env->results->usedPrimalNLPSolver != ES_PrimalNLPSolver::Ipopt)
+    {
+        env->output->outputDebug(" Fixed NLP problems will not be solved asynchronously since Ipopt is not used.");
+        this->runAsynchronously = false;
+    }
+
     this->originalIterFrequency = env->settings->getSetting<int>("FixedInteger.Frequency.Iteration", "Primal");
     this->originalTimeFrequency = env->settings->getSetting<double>("FixedInteger.Frequency.Time", "Primal");
 
@@ -159,6 +171,9 @@ TaskSelectPrimalCandidatesFromNLP::~TaskSelectPrimalCandidatesFromNLP() = defaul
 
 void TaskSelectPrimalCandidatesFromNLP::run()
 {
+    if(runAsynchronously)
+        collectAsynchronousSolutions(true);
+
     if(env->primalSolver->fixedPrimalNLPCandidates.size() == 0)
     {
         env->solutionStatistics.numberOfIterationsWithoutNLPCallMIP++;
@@ -174,7 +189,10 @@ void TaskSelectPrimalCandidatesFromNLP::run()
     env->timing->startTimer("PrimalStrategy");
     env->timing->startTimer("PrimalBoundStrategyNLP");
 
-    solveFixedNLP();
+    if(runAsynchronously)
+        startAsynchronousSolving();
+    else
+        solveFixedNLP();
 
     env->timing->stopTimer("PrimalBoundStrategyNLP");
     env->timing->stopTimer("PrimalStrategy");
@@ -182,6 +200,62 @@ void TaskSelectPrimalCandidatesFromNLP::run()
     return;
 }
 
+void TaskSelectPrimalCandidatesFromNLP::collectAsynchronousSolutions(bool waitForCompletion)
+{
+    if(!asynchronousSolutions.valid())
+        return;
+
+    if(!waitForCompletion && asynchronousSolutions.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return;
+
+    env->timing->startTimer("PrimalStrategy");
+    env->timing->startTimer("PrimalBoundStrategyNLP");
+
+    // Exceptions thrown when solving the problems are rethrown here
+    auto solutions = asynchronousSolutions.get();
+
+    env->output->outputDebug(
+        fmt::format("        Processing {} fixed NLP problems solved asynchronously.", solutions.size()));
+
+    for(auto& S : solutions)
+        processFixedNLPSolution(S);
+
+    env->timing->stopTimer("PrimalBoundStrategyNLP");
+    env->timing->stopTimer("PrimalStrategy");
+}
+
+void TaskSelectPrimalCandidatesFromNLP::stopAsynchronousSolving()
+{
+    collectAsynchronousSolutions(true);
+    runAsynchronously = false;
+}
+
+void TaskSelectPrimalCandidatesFromNLP::startAsynchronousSolving()
+{
+    updateVariableBoundsFromPresolve();
+
+    auto candidates = env->primalSolver->fixedPrimalNLPCandidates;
+    int iterationNumber = env->results->getCurrentIteration()->iterationNumber;
+
+    // Marked as used directly so that the same points are not selected again while the problems are solved
+    for(auto& CAND : candidates)
+        env->primalSolver->usedPrimalNLPCandidates.push_back(CAND);
+
+    env->output->outputDebug(
+        fmt::format("        Solving {} fixed NLP problems asynchronously.", candidates.size()));
+
+    // Only the NLP solver and the source problem are used in the thread, the solutions are processed afterwards
+    asynchronousSolutions = std::async(std::launch::async, [this, candidates, iterationNumber]() {
+        std::vector<FixedNLPSolution> solutions;
+        solutions.reserve(candidates.size());
+
+        for(size_t i = 0; i < candidates.size(); i++)
+            solutions.push_back(solveFixedNLP(candidates[i], iterationNumber, i));
+
+        return (solutions);
+    });
+}
+
 std::string TaskSelectPrimalCandidatesFromNLP::getType()
 {
     std::string type = typeid(this).name();
@@ -203,299 +277,329 @@ bool TaskSelectPrimalCandidatesFromNLP::solveFixedNLP()
         return (false);
     }
 
+    updateVariableBoundsFromPresolve();
+
     int counter = 0;
 
     for(auto& CAND : env->primalSolver->fixedPrimalNLPCandidates)
     {
-        VectorDouble fixedVariableValues(discreteVariableIndexes.size());
+        processFixedNLPSolution(solveFixedNLP(CAND, currIter->iterationNumber, counter));
+
+        counter++;
 
-        int sizeOfVariableVector = sourceProblem->properties.numberOfVariables;
+        env->primalSolver->usedPrimalNLPCandidates.push_back(CAND);
+    }
 
-        // TODO: remove?
-        if(env->settings->getSetting<bool>("FixedInteger.UsePresolveBounds", "Primal"))
-        {
-            env->output->outputDebug("         Updating variable bounds from MIP presolve.");
-            for(auto& V : env->reformulatedProblem->allVariables)
-            {
-                if(V->index > sizeOfVariableVector)
-                    continue;
-
-                if(V->properties.hasUpperBoundBeenTightened)
-                {
-                    NLPSolver->updateVariableUpperBound(V->index, V->upperBound);
-                }
-
-                if(V->properties.hasLowerBoundBeenTightened)
-                {
-                    NLPSolver->updateVariableLowerBound(V->index, V->upperBound);
-                }
-            }
-        }
+    return (true);
+}
 
-        VectorInteger startingPointIndexes(sizeOfVariableVector);
-        VectorDouble startingPointValues(sizeOfVariableVector);
+void TaskSelectPrimalCandidatesFromNLP::updateVariableBoundsFromPresolve()
+{
+    int sizeOfVariableVector = sourceProblem->properties.numberOfVariables;
 
-        // Sets the fixed values for discrete variables
-        for(size_t k = 0; k < discreteVariableIndexes.size(); k++)
+    // TODO: remove?
+    if(env->settings->getSetting<bool>("FixedInteger.UsePresolveBounds", "Primal"))
+    {
+        env->output->outputDebug("         Updating variable bounds from MIP presolve.");
+        for(auto& V : env->reformulatedProblem->allVariables)
         {
-            int currVarIndex = discreteVariableIndexes.at(k);
-
-            auto tmpSolPt = std::round(CAND.point.at(currVarIndex));
+            if(V->index > sizeOfVariableVector)
+                continue;
 
-            fixedVariableValues.at(k) = tmpSolPt;
+            if(V->properties.hasUpperBoundBeenTightened)
+            {
+                NLPSolver->updateVariableUpperBound(V->index, V->upperBound);
+            }
 
-            // Sets the starting point to the fixed value
-            if(env->settings->getSetting<bool>("FixedInteger.Warmstart", "Primal"))
+            if(V->properties.hasLowerBoundBeenTightened)
             {
-                startingPointIndexes.at(currVarIndex) = currVarIndex;
-                startingPointValues.at(currVarIndex) = tmpSolPt;
+                NLPSolver->updateVariableLowerBound(V->index, V->upperBound);
             }
         }
+    }
+}
 
-        if(env->settings->getSetting<bool>("FixedInteger.Warmstart", "Primal"))
-        {
-            env->output->outputDebug(
-                "         Setting warm start for continuous variable to candidate solution value.");
+TaskSelectPrimalCandidatesFromNLP::FixedNLPSolution TaskSelectPrimalCandidatesFromNLP::solveFixedNLP(
+    const PrimalFixedNLPCandidate& candidate, int iterationNumber, int counter)
+{
+    FixedNLPSolution solution;
+    solution.candidate = candidate;
 
-            for(auto& V : sourceProblem->realVariables)
-            {
-                startingPointIndexes.at(V->index) = V->index;
-                startingPointValues.at(V->index) = CAND.point.at(V->index);
-            }
+    VectorDouble fixedVariableValues(discreteVariableIndexes.size());
 
-            if(env->settings->getSetting<bool>("Debug.Enable", "Output"))
-            {
-                std::string filename = env->settings->getSetting<std::string>("Debug.Path", "Output")
-                    + "/primalnlp_warmstart" + std::to_string(currIter->iterationNumber) + "_" + std::to_string(counter)
-                    + ".txt";
+    int sizeOfVariableVector = sourceProblem->properties.numberOfVariables;
 
-                Utilities::saveVariablePointVectorToFile(startingPointValues, variableNames, filename);
-            }
+    VectorInteger startingPointIndexes(sizeOfVariableVector);
+    VectorDouble startingPointValues(sizeOfVariableVector);
+
+    // Sets the fixed values for discrete variables
+    for(size_t k = 0; k < discreteVariableIndexes.size(); k++)
+    {
+        int currVarIndex = discreteVariableIndexes.at(k);
+
+        auto tmpSolPt = std::round(candidate.point.at(currVarIndex));
+
+        fixedVariableValues.at(k) = tmpSolPt;
 
-            NLPSolver->setStartingPoint(startingPointIndexes, startingPointValues);
+        // Sets the starting point to the fixed value
+        if(env->settings->getSetting<bool>("FixedInteger.Warmstart", "Primal"))
+        {
+            startingPointIndexes.at(currVarIndex) = currVarIndex;
+            startingPointValues.at(currVarIndex) = tmpSolPt;
         }
+    }
 
-        NLPSolver->fixVariables(discreteVariableIndexes, fixedVariableValues);
+    if(env->settings->getSetting<bool>("FixedInteger.Warmstart", "Primal"))
+    {
+        env->output->outputDebug("         Setting warm start for continuous variable to candidate solution value.");
+
+        for(auto& V : sourceProblem->realVariables)
+        {
+            startingPointIndexes.at(V->index) = V->index;
+            startingPointValues.at(V->index) = candidate.point.at(V->index);
+        }
 
         if(env->settings->getSetting<bool>("Debug.Enable", "Output"))
         {
-            std::string filename = env->settings->getSetting<std::string>("Debug.Path", "Output") + "/primalnlp"
-                + std::to_string(currIter->iterationNumber) + "_" + std::to_string(counter);
-            NLPSolver->saveProblemToFile(filename + ".txt");
-            NLPSolver->saveOptionsToFile(filename + ".osrl");
+            std::string filename = env->settings->getSetting<std::string>("Debug.Path", "Output")
+                + "/primalnlp_warmstart" + std::to_string(iterationNumber) + "_" + std::to_string(counter) + ".txt";
+
+            Utilities::saveVariablePointVectorToFile(startingPointValues, variableNames, filename);
         }
 
-        auto solvestatus = NLPSolver->solveProblem();
+        NLPSolver->setStartingPoint(startingPointIndexes, startingPointValues);
+    }
 
-        NLPSolver->unfixVariables();
-        env->solutionStatistics.numberOfProblemsFixedNLP++;
+    NLPSolver->fixVariables(discreteVariableIndexes, fixedVariableValues);
 
-        std::string source = (sourceIsReformulatedProblem) ? "R" : "O";
+    if(env->settings->getSetting<bool>("Debug.Enable", "Output"))
+    {
+        std::string filename = env->settings->getSetting<std::string>("Debug.Path", "Output") + "/primalnlp"
+            + std::to_string(iterationNumber) + "_" + std::to_string(counter);
+        NLPSolver->saveProblemToFile(filename + ".txt");
+        NLPSolver->saveOptionsToFile(filename + ".osrl");
+    }
 
-        std::string sourceDesc;
-        switch(CAND.sourceType)
-        {
-        case E_PrimalNLPSource::FirstSolution:
-            env->output->outputDebug("         Source from candidate point is first MIP solution point.");
-            sourceDesc = "SOLPT-" + source;
-            break;
-        case E_PrimalNLPSource::FeasibleSolution:
-            env->output->outputDebug("         Source from candidate point is MIP solution pool.");
-            sourceDesc = "FEASP-" + source;
-            break;
-        case E_PrimalNLPSource::InfeasibleSolution:
-            env->output->outputDebug("         Source from candidate point is infeasible MIP solution.");
-            sourceDesc = "UNFEA-" + source;
-            break;
-        case E_PrimalNLPSource::SmallestDeviationSolution:
-            env->output->outputDebug(
-                "         Source from candidate point is MIP solution with smallest nonlinear error.");
-            sourceDesc = "SMDEV-" + source;
-            break;
-        case E_PrimalNLPSource::FirstSolutionNewDualBound:
-            env->output->outputDebug(
-                "         Source from candidate point is first MIP solution point which gave dual bound update.");
-            sourceDesc = "NEWDB-" + source;
-            break;
-        default:
-            break;
-        }
+    solution.status = NLPSolver->solveProblem();
 
-        switch(solvestatus)
-        {
-        case E_NLPSolutionStatus::Optimal:
-            env->output->outputDebug(fmt::format(
-                "         Optimal solution {} found to fixed NLP problem.", NLPSolver->getObjectiveValue()));
-            break;
+    NLPSolver->unfixVariables();
 
-        case E_NLPSolutionStatus::Feasible:
-            env->output->outputDebug(fmt::format(
-                "         Feasible solution {} found to fixed NLP problem.", NLPSolver->getObjectiveValue()));
-            break;
+    if(solution.status == E_NLPSolutionStatus::Feasible || solution.status == E_NLPSolutionStatus::Optimal
+        || sourceProblem->properties.numberOfNonlinearConstraints > 0)
+    {
+        solution.objectiveValue = NLPSolver->getObjectiveValue();
+        solution.point = NLPSolver->getSolution();
+    }
 
-        case E_NLPSolutionStatus::Infeasible:
-            env->output->outputDebug("         Fixed NLP problem is infeasible.");
-            break;
+    return (solution);
+}
 
-        case E_NLPSolutionStatus::Unbounded:
-            env->output->outputDebug("         Fixed NLP problem is unbounded.");
-            break;
+void TaskSelectPrimalCandidatesFromNLP::processFixedNLPSolution(const FixedNLPSolution& solution)
+{
+    auto currIter = env->results->getCurrentIteration();
+    auto& CAND = solution.candidate;
+    auto solvestatus = solution.status;
+
+    env->solutionStatistics.numberOfProblemsFixedNLP++;
 
-        case E_NLPSolutionStatus::TimeLimit:
-            env->output->outputDebug("         Time limit hit when solving fixed NLP problem.");
-            break;
+    std::string source = (sourceIsReformulatedProblem) ? "R" : "O";
 
-        case E_NLPSolutionStatus::IterationLimit:
-            env->output->outputDebug("         Iteration limit hit when solving fixed NLP problem.");
-            break;
+    std::string sourceDesc;
+    switch(CAND.sourceType)
+    {
+    case E_PrimalNLPSource::FirstSolution:
+        env->output->outputDebug("         Source from candidate point is first MIP solution point.");
+        sourceDesc = "SOLPT-" + source;
+        break;
+    case E_PrimalNLPSource::FeasibleSolution:
+        env->output->outputDebug("         Source from candidate point is MIP solution pool.");
+        sourceDesc = "FEASP-" + source;
+        break;
+    case E_PrimalNLPSource::InfeasibleSolution:
+        env->output->outputDebug("         Source from candidate point is infeasible MIP solution.");
+        sourceDesc = "UNFEA-" + source;
+        break;
+    case E_PrimalNLPSource::SmallestDeviationSolution:
+        env->output->outputDebug("         Source from candidate point is MIP solution with smallest nonlinear error.");
+        sourceDesc = "SMDEV-" + source;
+        break;
+    case E_PrimalNLPSource::FirstSolutionNewDualBound:
+        env->output->outputDebug(
+            "         Source from candidate point is first MIP solution point which gave dual bound update.");
+        sourceDesc = "NEWDB-" + source;
+        break;
+    default:
+        break;
+    }
 
-        case E_NLPSolutionStatus::Error:
-            env->output->outputDebug("         Error ocurred when solving fixed NLP problem.");
-            break;
+    switch(solvestatus)
+    {
+    case E_NLPSolutionStatus::Optimal:
+        env->output->outputDebug(fmt::format(
+            "         Optimal solution {} found to fixed NLP problem.", solution.objectiveValue));
+        break;
 
-        default:
+    case E_NLPSolutionStatus::Feasible:
+        env->output->outputDebug(fmt::format(
+            "         Feasible solution {} found to fixed NLP problem.", solution.objectiveValue));
+        break;
 
-            break;
-        }
+    case E_NLPSolutionStatus::Infeasible:
+        env->output->outputDebug("         Fixed NLP problem is infeasible.");
+        break;
 
-        if(solvestatus == E_NLPSolutionStatus::Feasible || solvestatus == E_NLPSolutionStatus::Optimal)
-        {
-            double tmpObj = NLPSolver->getObjectiveValue();
-            auto variableSolution = NLPSolver->getSolution();
+    case E_NLPSolutionStatus::Unbounded:
+        env->output->outputDebug("         Fixed NLP problem is unbounded.");
+        break;
 
-            if(env->settings->getSetting<bool>("FixedInteger.Frequency.Dynamic", "Primal"))
-            {
-                int iters = std::max(
-                    std::ceil(env->settings->getSetting<int>("FixedInteger.Frequency.Iteration", "Primal") * 0.98),
-                    originalNLPIter);
+    case E_NLPSolutionStatus::TimeLimit:
+        env->output->outputDebug("         Time limit hit when solving fixed NLP problem.");
+        break;
 
-                if(iters > std::max(0.1 * this->originalIterFrequency, 1.0))
-                    env->settings->updateSetting("FixedInteger.Frequency.Iteration", "Primal", iters);
+    case E_NLPSolutionStatus::IterationLimit:
+        env->output->outputDebug("         Iteration limit hit when solving fixed NLP problem.");
+        break;
 
-                double interval = std::max(
-                    0.9 * env->settings->getSetting<double>("FixedInteger.Frequency.Time", "Primal"), originalNLPTime);
+    case E_NLPSolutionStatus::Error:
+        env->output->outputDebug("         Error ocurred when solving fixed NLP problem.");
+        break;
 
-                if(interval > 0.1 * this->originalTimeFrequency)
-                    env->settings->updateSetting("FixedInteger.Frequency.Time", "Primal", interval);
+    default:
 
-                env->output->outputDebug(fmt::format(
-                    "         Iteration frequency updated to {} and time frequency updated to {} ", iters, interval));
-            }
+        break;
+    }
 
-            env->primalSolver->addPrimalSolutionCandidate(
-                variableSolution, E_PrimalSolutionSource::NLPFixedIntegers, currIter->iterationNumber);
+    if(solvestatus == E_NLPSolutionStatus::Feasible || solvestatus == E_NLPSolutionStatus::Optimal)
+    {
+        double tmpObj = solution.objectiveValue;
+        auto& variableSolution = solution.point;
 
-            if(sourceProblem->properties.numberOfNonlinearConstraints > 0
-                || sourceProblem->properties.numberOfQuadraticConstraints > 0)
-            {
-                auto mostDevConstr = sourceProblem->getMostDeviatingNonlinearOrQuadraticConstraint(variableSolution);
+        if(env->settings->getSetting<bool>("FixedInteger.Frequency.Dynamic", "Primal"))
+        {
+            int iters = std::max(
+                std::ceil(env->settings->getSetting<int>("FixedInteger.Frequency.Iteration", "Primal") * 0.98),
+                originalNLPIter);
 
-                env->output->outputDebug(fmt::format("         Max error {} from nonlinear or quadratic constraint {}.",
-                    mostDevConstr->normalizedValue, mostDevConstr->constraint->name));
+            if(iters > std::max(0.1 * this->originalIterFrequency, 1.0))
+                env->settings->updateSetting("FixedInteger.Frequency.Iteration", "Primal", iters);
 
-                env->report->outputIterationDetail(env->solutionStatistics.numberOfProblemsFixedNLP,
-                    ("NLP" + sourceDesc), env->timing->getElapsedTime("Total"), currIter->numHyperplanesAdded,
-                    currIter->totNumHyperplanes, env->results->getCurrentDualBound(), env->results->getPrimalBound(),
-                    env->results->getAbsoluteGlobalObjectiveGap(), env->results->getRelativeGlobalObjectiveGap(),
-                    tmpObj, mostDevConstr->constraint->index, mostDevConstr->normalizedValue,
-                    E_IterationLineType::PrimalNLP);
-            }
-            else
-            {
-                env->report->outputIterationDetail(env->solutionStatistics.numberOfProblemsFixedNLP,
-                    ("NLP" + sourceDesc), env->timing->getElapsedTime("Total"), currIter->numHyperplanesAdded,
-                    currIter->totNumHyperplanes, env->results->getCurrentDualBound(), env->results->getPrimalBound(),
-                    env->results->getAbsoluteGlobalObjectiveGap(), env->results->getRelativeGlobalObjectiveGap(),
-                    tmpObj,
-                    -1, // Not shown
-                    0.0, // Not shown
-                    E_IterationLineType::PrimalNLP);
-            }
+            double interval = std::max(
+                0.9 * env->settings->getSetting<double>("FixedInteger.Frequency.Time", "Primal"), originalNLPTime);
 
-            // Add integer cut.
-            if(env->settings->getSetting<bool>("HyperplaneCuts.UseIntegerCuts", "Dual")
-                && sourceProblem->properties.numberOfDiscreteVariables > 0)
-                createIntegerCut(CAND.point);
+            if(interval > 0.1 * this->originalTimeFrequency)
+                env->settings->updateSetting("FixedInteger.Frequency.Time", "Primal", interval);
 
-            if(env->settings->getSetting<bool>("FixedInteger.CreateInfeasibilityCut", "Primal"))
-                createInfeasibilityCut(variableSolution);
+            env->output->outputDebug(fmt::format(
+                "         Iteration frequency updated to {} and time frequency updated to {} ", iters, interval));
         }
-        else if(sourceProblem->properties.numberOfNonlinearConstraints > 0)
+
+        env->primalSolver->addPrimalSolutionCandidate(
+            variableSolution, E_PrimalSolutionSource::NLPFixedIntegers, currIter->iterationNumber);
+
+        if(sourceProblem->properties.numberOfNonlinearConstraints > 0
+            || sourceProblem->properties.numberOfQuadraticConstraints > 0)
         {
-            double tmpObj = NLPSolver->getObjectiveValue();
+            auto mostDevConstr = sourceProblem->getMostDeviatingNonlinearOrQuadraticConstraint(variableSolution);
 
-            // Utilize the solution point for adding a cutting plane / supporting hyperplane
+            env->output->outputDebug(fmt::format("         Max error {} from nonlinear or quadratic constraint {}.",
+                mostDevConstr->normalizedValue, mostDevConstr->constraint->name));
 
-            auto variableSolution = NLPSolver->getSolution();
+            env->report->outputIterationDetail(env->solutionStatistics.numberOfProblemsFixedNLP,
+                ("NLP" + sourceDesc), env->timing->getElapsedTime("Total"), currIter->numHyperplanesAdded,
+                currIter->totNumHyperplanes, env->results->getCurrentDualBound(), env->results->getPrimalBound(),
+                env->results->getAbsoluteGlobalObjectiveGap(), env->results->getRelativeGlobalObjectiveGap(),
+                tmpObj, mostDevConstr->constraint->index, mostDevConstr->normalizedValue,
+                E_IterationLineType::PrimalNLP);
+        }
+        else
+        {
+            env->report->outputIterationDetail(env->solutionStatistics.numberOfProblemsFixedNLP,
+                ("NLP" + sourceDesc), env->timing->getElapsedTime("Total"), currIter->numHyperplanesAdded,
+                currIter->totNumHyperplanes, env->results->getCurrentDualBound(), env->results->getPrimalBound(),
+                env->results->getAbsoluteGlobalObjectiveGap(), env->results->getRelativeGlobalObjectiveGap(),
+                tmpObj,
+                -1, // Not shown
+                0.0, // Not shown
+                E_IterationLineType::PrimalNLP);
+        }
 
-            if(variableSolution.size() > 0)
-            {
-                auto mostDevConstr = sourceProblem->getMaxNumericConstraintValue(
-                    variableSolution, sourceProblem->nonlinearConstraints);
-
-                if(env->settings->getSetting<bool>("FixedInteger.CreateInfeasibilityCut", "Primal"))
-                    createInfeasibilityCut(variableSolution);
-
-                env->report->outputIterationDetail(env->solutionStatistics.numberOfProblemsFixedNLP,
-                    ("NLP" + sourceDesc), env->timing->getElapsedTime("Total"), currIter->numHyperplanesAdded,
-                    currIter->totNumHyperplanes, env->results->getCurrentDualBound(), env->results->getPrimalBound(),
-                    env->results->getAbsoluteGlobalObjectiveGap(), env->results->getRelativeGlobalObjectiveGap(),
-                    tmpObj, mostDevConstr.constraint->index, mostDevConstr.normalizedValue,
-                    E_IterationLineType::PrimalNLP);
-            }
-            else
-            {
-                env->report->outputIterationDetail(env->solutionStatistics.numberOfProblemsFixedNLP,
-                    ("NLP" + sourceDesc), env->timing->getElapsedTime("Total"), currIter->numHyperplanesAdded,
-                    currIter->totNumHyperplanes, env->results->getCurrentDualBound(), env->results->getPrimalBound(),
-                    env->results->getAbsoluteGlobalObjectiveGap(), env->results->getRelativeGlobalObjectiveGap(), NAN,
-                    -1, NAN, E_IterationLineType::PrimalNLP);
-            }
+        // Add integer cut.
+        if(env->settings->getSetting<bool>("HyperplaneCuts.UseIntegerCuts", "Dual")
+            && sourceProblem->properties.numberOfDiscreteVariables > 0)
+            createIntegerCut(CAND.point);
 
-            if(env->settings->getSetting<bool>("FixedInteger.Frequency.Dynamic", "Primal"))
-            {
-                int iters
-                    = std::ceil(env->settings->getSetting<int>("FixedInteger.Frequency.Iteration", "Primal") * 1.02);
+        if(env->settings->getSetting<bool>("FixedInteger.CreateInfeasibilityCut", "Primal"))
+            createInfeasibilityCut(variableSolution);
+    }
+    else if(sourceProblem->properties.numberOfNonlinearConstraints > 0)
+    {
+        double tmpObj = solution.objectiveValue;
 
-                if(iters < 10 * this->originalIterFrequency)
-                    env->settings->updateSetting("FixedInteger.Frequency.Iteration", "Primal", iters);
+        // Utilize the solution point for adding a cutting plane / supporting hyperplane
 
-                double interval = 1.1 * env->settings->getSetting<double>("FixedInteger.Frequency.Time", "Primal");
+        auto& variableSolution = solution.point;
 
-                if(interval < 10 * this->originalTimeFrequency)
-                    env->settings->updateSetting("FixedInteger.Frequency.Time", "Primal", interval);
+        if(variableSolution.size() > 0)
+        {
+            auto mostDevConstr = sourceProblem->getMaxNumericConstraintValue(
+                variableSolution, sourceProblem->nonlinearConstraints);
 
-                env->output->outputDebug(fmt::format(
-                    "         Iteration frequency updated to {} and time frequency updated to {} ", iters, interval));
-            }
+            if(env->settings->getSetting<bool>("FixedInteger.CreateInfeasibilityCut", "Primal"))
+                createInfeasibilityCut(variableSolution);
 
-            // Add integer cut.
-            if(env->settings->getSetting<bool>("HyperplaneCuts.UseIntegerCuts", "Dual")
-                && sourceProblem->properties.numberOfDiscreteVariables > 0)
-                createIntegerCut(CAND.point);
+            env->report->outputIterationDetail(env->solutionStatistics.numberOfProblemsFixedNLP,
+                ("NLP" + sourceDesc), env->timing->getElapsedTime("Total"), currIter->numHyperplanesAdded,
+                currIter->totNumHyperplanes, env->results->getCurrentDualBound(), env->results->getPrimalBound(),
+                env->results->getAbsoluteGlobalObjectiveGap(), env->results->getRelativeGlobalObjectiveGap(),
+                tmpObj, mostDevConstr.constraint->index, mostDevConstr.normalizedValue,
+                E_IterationLineType::PrimalNLP);
         }
         else
         {
-            env->report->outputIterationDetail(env->solutionStatistics.numberOfProblemsFixedNLP, ("NLP" + sourceDesc),
-                env->timing->getElapsedTime("Total"), currIter->numHyperplanesAdded, currIter->totNumHyperplanes,
-                env->results->getCurrentDualBound(), env->results->getPrimalBound(),
-                env->results->getAbsoluteGlobalObjectiveGap(), env->results->getRelativeGlobalObjectiveGap(), NAN, -1,
-                NAN, E_IterationLineType::PrimalNLP);
-
-            // Add integer cut.
-            if(env->settings->getSetting<bool>("HyperplaneCuts.UseIntegerCuts", "Dual")
-                && sourceProblem->properties.numberOfDiscreteVariables > 0)
-                createIntegerCut(CAND.point);
+            env->report->outputIterationDetail(env->solutionStatistics.numberOfProblemsFixedNLP,
+                ("NLP" + sourceDesc), env->timing->getElapsedTime("Total"), currIter->numHyperplanesAdded,
+                currIter->totNumHyperplanes, env->results->getCurrentDualBound(), env->results->getPrimalBound(),
+                env->results->getAbsoluteGlobalObjectiveGap(), env->results->getRelativeGlobalObjectiveGap(), NAN,
+                -1, NAN, E_IterationLineType::PrimalNLP);
         }
 
-        env->solutionStatistics.numberOfIterationsWithoutNLPCallMIP = 0;
-        env->solutionStatistics.timeLastFixedNLPCall = env->timing->getElapsedTime("Total");
-        counter++;
+        if(env->settings->getSetting<bool>("FixedInteger.Frequency.Dynamic", "Primal"))
+        {
+            int iters = std::ceil(env->settings->getSetting<int>("FixedInteger.Frequency.Iteration", "Primal") * 1.02);
 
-        env->primalSolver->usedPrimalNLPCandidates.push_back(CAND);
+            if(iters < 10 * this->originalIterFrequency)
+                env->settings->updateSetting("FixedInteger.Frequency.Iteration", "Primal", iters);
+
+            double interval = 1.1 * env->settings->getSetting<double>("FixedInteger.Frequency.Time", "Primal");
+
+            if(interval < 10 * this->originalTimeFrequency)
+                env->settings->updateSetting("FixedInteger.Frequency.Time", "Primal", interval);
+
+            env->output->outputDebug(fmt::format(
+                "         Iteration frequency updated to {} and time frequency updated to {} ", iters, interval));
+        }
+
+        // Add integer cut.
+        if(env->settings->getSetting<bool>("HyperplaneCuts.UseIntegerCuts", "Dual")
+            && sourceProblem->properties.numberOfDiscreteVariables > 0)
+            createIntegerCut(CAND.point);
+    }
+    else
+    {
+        env->report->outputIterationDetail(env->solutionStatistics.numberOfProblemsFixedNLP, ("NLP" + sourceDesc),
+            env->timing->getElapsedTime("Total"), currIter->numHyperplanesAdded, currIter->totNumHyperplanes,
+            env->results->getCurrentDualBound(), env->results->getPrimalBound(),
+            env->results->getAbsoluteGlobalObjectiveGap(), env->results->getRelativeGlobalObjectiveGap(), NAN, -1,
+            NAN, E_IterationLineType::PrimalNLP);
+
+        // Add integer cut.
+        if(env->settings->getSetting<bool>("HyperplaneCuts.UseIntegerCuts", "Dual")
+            && sourceProblem->properties.numberOfDiscreteVariables > 0)
+            createIntegerCut(CAND.point);
     }
 
-    return (true);
+    env->solutionStatistics.numberOfIterationsWithoutNLPCallMIP = 0;
+    env->solutionStatistics.timeLastFixedNLPCall = env->timing->getElapsedTime("Total");
 }
 
 void TaskSelectPrimalCandidatesFromNLP::createInfeasibilityCut(const VectorDouble variableSolution)
@@ -582,14 +686,97 @@ void TaskSelectPrimalCandidatesFromNLP::createIntegerCut(VectorDouble variableSo
 
     IntegerCut integerCut;
     integerCut.source = E_IntegerCutSource::NLPFixedInteger;
-    integerCut.variableValues.reserve(discreteVariableIndexes.size());
 
-    integerCut.variableIndexes = discreteVariableIndexes;
+    if(env->settings->getSetting<bool>("HyperplaneCuts.MinimizeIntegerCuts", "Dual"))
+        integerCut.variableIndexes = minimizeIntegerCutConflict(variableSolution);
+    else
+        integerCut.variableIndexes = discreteVariableIndexes;
+
+    integerCut.variableValues.reserve(integerCut.variableIndexes.size());
 
-    for(auto& I : discreteVariableIndexes)
+    for(auto& I : integerCut.variableIndexes)
         integerCut.variableValues.push_back(round(variableSolution.at(I)));
 
+    if(integerCut.variableIndexes.size() < discreteVariableIndexes.size())
+    {
+        env->output->outputDebug(fmt::format("         Integer cut reduced to {} of {} discrete variables.",
+            integerCut.variableIndexes.size(), discreteVariableIndexes.size()));
+    }
+
     env->dualSolver->addIntegerCut(integerCut);
 }
 
+VectorInteger TaskSelectPrimalCandidatesFromNLP::minimizeIntegerCutConflict(const VectorDouble& point)
+{
+    // Uses a deletion filter: the fixings of the discrete variables are released one at a time, and a fixing is kept
+    // only if the remaining ones can no longer be proven infeasible. Infeasibility is proven by interval evaluation
+    // of the constraints, so if the full fixing cannot be proven infeasible, e.g., if the fixed NLP problem was
+    // feasible, all discrete variables are returned.
+
+    double constraintTolerance = env->settings->getSetting<double>("ConstraintTolerance", "Termination");
+
+    auto originalBounds = sourceProblem->getVariableBounds();
+    auto variableBounds = originalBounds;
+
+    for(auto& I : discreteVariableIndexes)
+        variableBounds[I] = Interval(round(point.at(I)));
+
+    // A constraint that cannot be evaluated over the bounds is not proven infeasible, so the released variable is
+    // kept in the cut
+    auto isProvenInfeasible = [&](NumericConstraint* constraint) {
+        return (constraint->isProvenInfeasible(variableBounds, constraintTolerance));
+    };
+
+    std::vector<bool> isConstraintInfeasible(sourceProblem->numericConstraints.size(), false);
+    int numberOfInfeasibleConstraints = 0;
+
+    for(auto& C : sourceProblem->numericConstraints)
+    {
+        if(isProvenInfeasible(C.get()))
+        {
+            isConstraintInfeasible[C->index] = true;
+            numberOfInfeasibleConstraints++;
+        }
+    }
+
+    if(numberOfInfeasibleConstraints == 0)
+        return (discreteVariableIndexes);
+
+    VectorInteger conflict;
+
+    for(auto& I : discreteVariableIndexes)
+    {
+        variableBounds[I] = originalBounds[I];
+
+        // Only the constraints containing the released variable can become feasible
+        VectorInteger noLongerInfeasible;
+
+        for(auto& C : sourceProblem->getConstraintsWithVariable(I))
+        {
+            if(isConstraintInfeasible[C->index] && !isProvenInfeasible(C))
+                noLongerInfeasible.push_back(C->index);
+        }
+
+        if((int)noLongerInfeasible.size() < numberOfInfeasibleConstraints)
+        {
+            // The remaining fixings are still infeasible, so this one is not needed in the cut
+            for(auto& J : noLongerInfeasible)
+                isConstraintInfeasible[J] = false;
+
+            numberOfInfeasibleConstraints -= noLongerInfeasible.size();
+        }
+        else
+        {
+            variableBounds[I] = Interval(round(point.at(I)));
+            conflict.push_back(I);
+        }
+    }
+
+    // The continuous variable bounds are infeasible by themselves, so the full cut is used to be on the safe side
+    if(conflict.size() == 0)
+        return (discreteVariableIndexes);
+
+    return (conflict);
+}
+
 } // namespace SHOT
\ No newline at end of file
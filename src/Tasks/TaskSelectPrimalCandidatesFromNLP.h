@@ -11,10 +11,12 @@
 #pragma once
 #include "TaskBase.h"
 
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "../Enums.h"
 #include "../Structs.h"
 
 namespace SHOT
@@ -24,17 +26,45 @@ class INLPSolver;
 class TaskSelectPrimalCandidatesFromNLP : public TaskBase
 {
 public:
-    TaskSelectPrimalCandidatesFromNLP(EnvironmentPtr envPtr, bool useReformulatedProblem);
+    // If runAsynchronously is true, the fixed NLP problems are solved in a separate thread while the solver continues,
+    // and the solutions are processed when the task is run the next time or when collectAsynchronousSolutions() is
+    // called. This is only supported for Ipopt, otherwise the problems are solved in the calling thread.
+    TaskSelectPrimalCandidatesFromNLP(
+        EnvironmentPtr envPtr, bool useReformulatedProblem, bool runAsynchronously = false);
     ~TaskSelectPrimalCandidatesFromNLP() override;
     void run() override;
     std::string getType() override;
 
+    // Processes the solutions to the fixed NLP problems solved in the separate thread. If waitForCompletion is false,
+    // nothing is done if the problems are still being solved.
+    void collectAsynchronousSolutions(bool waitForCompletion);
+
+    // Waits for the problems being solved in the separate thread, and solves the following ones in the calling thread
+    void stopAsynchronousSolving();
+
 private:
+    struct FixedNLPSolution
+    {
+        PrimalFixedNLPCandidate candidate;
+        E_NLPSolutionStatus status;
+        double objectiveValue = NAN;
+        VectorDouble point;
+    };
+
     virtual bool solveFixedNLP();
 
+    void updateVariableBoundsFromPresolve();
+    FixedNLPSolution solveFixedNLP(const PrimalFixedNLPCandidate& candidate, int iterationNumber, int counter);
+    void processFixedNLPSolution(const FixedNLPSolution& solution);
+
+    void startAsynchronousSolving();
+
     void createInfeasibilityCut(const VectorDouble point);
     void createIntegerCut(VectorDouble point);
 
+    // Returns a small subset of the discrete variables whose values in the point are infeasible by themselves
+    VectorInteger minimizeIntegerCutConflict(const VectorDouble& point);
+
     std::shared_ptr<INLPSolver> NLPSolver;
 
     VectorInteger discreteVariableIndexes;
@@ -56,5 +86,8 @@ private:
 
     ProblemPtr sourceProblem;
     bool sourceIsReformulatedProblem = false;
+
+    bool runAsynchronously = false;
+    std::future<std::vector<FixedNLPSolution>> asynchronousSolutions; // Waits for the thread when destroyed
 };
 } // namespace SHOT
\ No newline at end of file
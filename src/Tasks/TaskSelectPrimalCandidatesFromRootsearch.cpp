@@ -39,6 +39,27 @@ std::string TaskSelectPrimalCandidatesFromRootsearch::getType()
     return (type);
 }
 
+NumericConstraintValues TaskSelectPrimalCandidatesFromRootsearch::getInteriorPointConstraintValues(
+    const VectorDouble& interiorPoint)
+{
+    std::lock_guard<std::mutex> lock(interiorPointConstraintValuesMutex);
+
+    for(auto& CV : interiorPointConstraintValues)
+    {
+        if(CV.first == interiorPoint)
+            return (CV.second);
+    }
+
+    // The interior points are replaced if they are updated, so only the latest ones are kept
+    if(interiorPointConstraintValues.size() > env->dualSolver->interiorPts.size())
+        interiorPointConstraintValues.clear();
+
+    interiorPointConstraintValues.emplace_back(
+        interiorPoint, env->reformulatedProblem->getNumericConstraintValues(interiorPoint));
+
+    return (interiorPointConstraintValues.back().second);
+}
+
 void TaskSelectPrimalCandidatesFromRootsearch::run(std::vector<SolutionPoint> solPoints)
 {
     auto currIter = env->results->getCurrentIteration();
@@ -51,35 +72,48 @@ void TaskSelectPrimalCandidatesFromRootsearch::run(std::vector<SolutionPoint> so
 
         for(auto& P : solPoints)
         {
+            auto maxDevMIP = env->reformulatedProblem->getMaxNumericConstraintValue(
+                P.point, env->reformulatedProblem->nonredundantNumericConstraints);
+
             for(auto& IP : env->dualSolver->interiorPts)
             {
+                // A rootsearch is only performed towards infeasible solution points
+                if(maxDevMIP.normalizedValue <= 0)
+                    break;
+
                 auto xNLP = IP->point;
 
-                auto solPoint = P.point;
+                assert(xNLP.size() == P.point.size());
 
-                assert(xNLP.size() == solPoint.size());
+                // The interior point with the discrete variable values from the solution point
+                VectorInteger changedVariableIndexes;
 
-                for(auto& V : env->reformulatedProblem->binaryVariables)
-                {
-                    xNLP.at(V->index) = P.point.at(V->index);
-                }
+                auto copyVariableValues = [&](const Variables& variables) {
+                    for(auto& V : variables)
+                    {
+                        if(xNLP.at(V->index) == P.point.at(V->index))
+                            continue;
 
-                for(auto& V : env->reformulatedProblem->integerVariables)
-                {
-                    xNLP.at(V->index) = P.point.at(V->index);
-                }
+                        xNLP.at(V->index) = P.point.at(V->index);
+                        changedVariableIndexes.push_back(V->index);
+                    }
+                };
 
-                for(auto& V : env->reformulatedProblem->semiintegerVariables)
-                {
-                    xNLP.at(V->index) = P.point.at(V->index);
-                }
+                copyVariableValues(env->reformulatedProblem->binaryVariables);
+                copyVariableValues(env->reformulatedProblem->integerVariables);
+                copyVariableValues(env->reformulatedProblem->semiintegerVariables);
+
+                // Only the constraints containing the changed variables need to be recalculated
+                auto constraintValues = getInteriorPointConstraintValues(IP->point);
+                env->reformulatedProblem->updateNumericConstraintValues(
+                    xNLP, changedVariableIndexes, constraintValues);
+
+                double maxDevNLP = SHOT_DBL_MIN;
 
-                auto maxDevNLP2 = env->reformulatedProblem->getMaxNumericConstraintValue(
-                    xNLP, env->reformulatedProblem->numericConstraints);
-                auto maxDevMIP = env->reformulatedProblem->getMaxNumericConstraintValue(
-                    P.point, env->reformulatedProblem->numericConstraints);
+                for(auto& CV : constraintValues)
+                    maxDevNLP = std::max(maxDevNLP, CV.normalizedValue);
 
-                if(maxDevNLP2.normalizedValue < 0 && maxDevMIP.normalizedValue > 0)
+                if(maxDevNLP < 0)
                 {
                     std::pair<VectorDouble, VectorDouble> xNewc;
 
@@ -89,7 +123,7 @@ void TaskSelectPrimalCandidatesFromRootsearch::run(std::vector<SolutionPoint> so
                         xNewc = env->rootsearchMethod->findZero(xNLP, P.point,
                             env->settings->getSetting<int>("Rootsearch.MaxIterations", "Subsolver"),
                             env->settings->getSetting<double>("Rootsearch.TerminationTolerance", "Subsolver"), 0,
-                            env->reformulatedProblem->nonlinearConstraints, false);
+                            env->reformulatedProblem->nonredundantNonlinearConstraints, false);
 
                         env->timing->stopTimer("PrimalBoundStrategyRootSearch");
 
@@ -13,6 +13,10 @@
 
 #include "../Structs.h"
 
+#include "../Model/Constraints.h"
+
+#include <mutex>
+
 namespace SHOT
 {
 class TaskSelectPrimalCandidatesFromRootsearch : public TaskBase
@@ -26,5 +30,10 @@ public:
     std::string getType() override;
 
 private:
+    // The constraint values in the interior points, which are updated for the discrete variables in each solution
+    std::vector<std::pair<VectorDouble, NumericConstraintValues>> interiorPointConstraintValues;
+    std::mutex interiorPointConstraintValuesMutex;
+
+    NumericConstraintValues getInteriorPointConstraintValues(const VectorDouble& interiorPoint);
 };
 } // namespace SHOT
\ No newline at end of file
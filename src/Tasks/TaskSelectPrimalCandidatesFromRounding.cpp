@@ -0,0 +1,260 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "TaskSelectPrimalCandidatesFromRounding.h"
+
+#include "../Iteration.h"
+#include "../Output.h"
+#include "../PrimalSolver.h"
+#include "../Results.h"
+#include "../Settings.h"
+#include "../Timing.h"
+
+#include "../Model/Problem.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SHOT
+{
+
+TaskSelectPrimalCandidatesFromRounding::TaskSelectPrimalCandidatesFromRounding(EnvironmentPtr envPtr)
+    : TaskBase(envPtr)
+{
+    linearTolerance = env->settings->getSetting<double>("Tolerance.LinearConstraint", "Primal");
+    nonlinearTolerance = env->settings->getSetting<double>("Tolerance.NonlinearConstraint", "Primal");
+    maxIterations = env->settings->getSetting<int>("Rounding.IterationLimit", "Primal");
+}
+
+TaskSelectPrimalCandidatesFromRounding::~TaskSelectPrimalCandidatesFromRounding() = default;
+
+void TaskSelectPrimalCandidatesFromRounding::run()
+{
+    auto currIter = env->results->getCurrentIteration();
+
+    if(currIter->solutionPoints.size() == 0)
+        return;
+
+    // The candidates are checked in the original problem, whose variables are first in the dual solution point
+    auto& solutionPoint = currIter->solutionPoints.at(0).point;
+    VectorDouble point(solutionPoint.begin(), solutionPoint.begin() + env->problem->properties.numberOfVariables);
+
+    roundPoint(point);
+
+    // The MIP solution often rounds to the same point in consecutive iterations, e.g., when only the continuous
+    // variables change slightly, and the repair would then give the same candidate again
+    if(point == previousRoundedPoint)
+    {
+        env->output->outputTrace("        Rounded dual solution point has already been repaired.");
+        return;
+    }
+
+    previousRoundedPoint = point;
+
+    env->timing->startTimer("PrimalStrategy");
+    env->timing->startTimer("PrimalBoundStrategyRounding");
+
+    auto constraintValues = env->problem->getNumericConstraintValues(point);
+
+    // Nonlinear steps may violate the linear constraints again, so these are repaired once more
+    bool isRepaired = repairLinearConstraints(point, constraintValues)
+        && repairNonlinearConstraints(point, constraintValues) && repairLinearConstraints(point, constraintValues);
+
+    if(isRepaired)
+    {
+        env->output->outputDebug("        Rounded and repaired dual solution point is a primal solution candidate.");
+        env->primalSolver->addPrimalSolutionCandidate(
+            point, E_PrimalSolutionSource::RoundingAndRepair, currIter->iterationNumber);
+    }
+    else
+    {
+        env->output->outputDebug("        Could not repair rounded dual solution point.");
+    }
+
+    env->timing->stopTimer("PrimalBoundStrategyRounding");
+    env->timing->stopTimer("PrimalStrategy");
+}
+
+void TaskSelectPrimalCandidatesFromRounding::roundPoint(VectorDouble& point)
+{
+    for(auto& V : env->problem->allVariables)
+    {
+        if(!isMovable(V))
+            continue;
+
+        auto& value = point[V->index];
+
+        if(V->properties.type != E_VariableType::Real)
+            value = std::round(value);
+
+        value = std::clamp(value, V->lowerBound, V->upperBound);
+    }
+}
+
+bool TaskSelectPrimalCandidatesFromRounding::repairLinearConstraints(
+    VectorDouble& point, NumericConstraintValues& constraintValues)
+{
+    for(int i = 0; i < maxIterations; i++)
+    {
+        // Repairs the most violated linear constraint first
+        LinearConstraint* constraint = nullptr;
+        double error = linearTolerance;
+
+        for(auto& C : env->problem->linearConstraints)
+        {
+            if(constraintValues[C->index].error > error)
+            {
+                constraint = C.get();
+                error = constraintValues[C->index].error;
+            }
+        }
+
+        if(constraint == nullptr)
+            return (true);
+
+        // The direction the constraint function value should be changed in
+        double direction = constraintValues[constraint->index].isFulfilledRHS ? 1.0 : -1.0;
+
+        // Selects the variable move that decreases the total violation of the affected constraints the most
+        VariablePtr bestVariable;
+        double bestValue = 0.0;
+        double bestChange = 0.0;
+
+        for(auto& T : constraint->linearTerms)
+        {
+            if(T->coefficient == 0.0 || !isMovable(T->variable))
+                continue;
+
+            auto index = T->variable->index;
+            double oldValue = point[index];
+            double step = direction * error / T->coefficient;
+
+            if(T->variable->properties.type != E_VariableType::Real)
+                step = (step > 0) ? std::ceil(step - 1e-9) : std::floor(step + 1e-9);
+
+            double newValue = std::clamp(oldValue + step, T->variable->lowerBound, T->variable->upperBound);
+
+            if(newValue == oldValue)
+                continue;
+
+            double change = 0.0;
+            point[index] = newValue;
+
+            for(auto& C : env->problem->getConstraintsWithVariable(index))
+                change += C->calculateNumericValue(point).error - constraintValues[C->index].error;
+
+            point[index] = oldValue;
+
+            if(change < bestChange)
+            {
+                bestVariable = T->variable;
+                bestValue = newValue;
+                bestChange = change;
+            }
+        }
+
+        if(!bestVariable)
+            return (false);
+
+        point[bestVariable->index] = bestValue;
+        env->problem->updateNumericConstraintValues(point, { bestVariable->index }, constraintValues);
+    }
+
+    return (false);
+}
+
+bool TaskSelectPrimalCandidatesFromRounding::repairNonlinearConstraints(
+    VectorDouble& point, NumericConstraintValues& constraintValues)
+{
+    for(int i = 0; i < maxIterations; i++)
+    {
+        // Takes a step for the most violated quadratic or nonlinear constraint
+        NumericConstraint* constraint = nullptr;
+        double error = nonlinearTolerance;
+
+        for(auto& C : env->problem->quadraticConstraints)
+        {
+            if(constraintValues[C->index].error > error)
+            {
+                constraint = C.get();
+                error = constraintValues[C->index].error;
+            }
+        }
+
+        for(auto& C : env->problem->nonlinearConstraints)
+        {
+            if(constraintValues[C->index].error > error)
+            {
+                constraint = C.get();
+                error = constraintValues[C->index].error;
+            }
+        }
+
+        if(constraint == nullptr)
+            return (true);
+
+        double direction = constraintValues[constraint->index].isFulfilledRHS ? 1.0 : -1.0;
+
+        // Only the continuous variables are changed, the rounded discrete variables are kept fixed
+        auto gradient = constraint->calculateGradient(point, true);
+
+        double squaredGradientNorm = 0.0;
+
+        for(auto& G : gradient)
+        {
+            if(isMovable(G.first) && G.first->properties.type == E_VariableType::Real)
+                squaredGradientNorm += G.second * G.second;
+        }
+
+        if(squaredGradientNorm < 1e-12)
+            return (false);
+
+        // A step to the zero of the linearization of the constraint, projected onto the variable bounds
+        double stepLength = direction * error / squaredGradientNorm;
+        VectorInteger changedVariableIndexes;
+
+        for(auto& G : gradient)
+        {
+            if(!isMovable(G.first) || G.first->properties.type != E_VariableType::Real)
+                continue;
+
+            auto index = G.first->index;
+            double newValue
+                = std::clamp(point[index] + stepLength * G.second, G.first->lowerBound, G.first->upperBound);
+
+            if(newValue == point[index])
+                continue;
+
+            point[index] = newValue;
+            changedVariableIndexes.push_back(index);
+        }
+
+        if(changedVariableIndexes.size() == 0)
+            return (false);
+
+        env->problem->updateNumericConstraintValues(point, changedVariableIndexes, constraintValues);
+    }
+
+    return (false);
+}
+
+bool TaskSelectPrimalCandidatesFromRounding::isMovable(const VariablePtr& variable)
+{
+    // Semicontinuous and semiinteger variables are left to the projection in the primal solution check
+    return (variable->properties.type == E_VariableType::Real || variable->properties.type == E_VariableType::Binary
+        || variable->properties.type == E_VariableType::Integer);
+}
+
+std::string TaskSelectPrimalCandidatesFromRounding::getType()
+{
+    std::string type = typeid(this).name();
+    return (type);
+}
+} // namespace SHOT
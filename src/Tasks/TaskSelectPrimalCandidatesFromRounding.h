@@ -0,0 +1,49 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+#include "TaskBase.h"
+
+#include "../Structs.h"
+
+#include "../Model/Constraints.h"
+
+namespace SHOT
+{
+// Rounds the dual solution point and repairs the violated constraints with greedy variable moves and projected
+// gradient steps. This gives primal solutions cheaply, often before the first NLP problem has been solved.
+class TaskSelectPrimalCandidatesFromRounding : public TaskBase
+{
+public:
+    TaskSelectPrimalCandidatesFromRounding(EnvironmentPtr envPtr);
+    ~TaskSelectPrimalCandidatesFromRounding() override;
+
+    void run() override;
+    std::string getType() override;
+
+private:
+    double linearTolerance;
+    double nonlinearTolerance;
+    int maxIterations;
+
+    // The rounded point in the previous call, the repair is only performed again if it has changed
+    VectorDouble previousRoundedPoint;
+
+    void roundPoint(VectorDouble& point);
+
+    // Returns true if all linear constraints are fulfilled afterwards
+    bool repairLinearConstraints(VectorDouble& point, NumericConstraintValues& constraintValues);
+
+    // Returns true if all quadratic and nonlinear constraints are fulfilled afterwards
+    bool repairNonlinearConstraints(VectorDouble& point, NumericConstraintValues& constraintValues);
+
+    bool isMovable(const VariablePtr& variable);
+};
+} // namespace SHOT
@@ -32,7 +32,7 @@ void TaskSelectPrimalFixedNLPPointsFromSolutionPool::run()
     env->timing->startTimer("PrimalBoundStrategyNLP");
 
     auto currIter = env->results->getCurrentIteration();
-    auto allSolutions = env->results->getCurrentIteration()->solutionPoints;
+    auto& allSolutions = currIter->solutionPoints;
 
     bool callNLPSolver = false;
     bool useFeasibleSolutionExtra = false;
@@ -92,6 +92,7 @@ void TaskSelectPrimalFixedNLPPointsFromSolutionPool::run()
     if(useFeasibleSolutionExtra)
     {
         auto tmpSol = allSolutions.at(0);
+        tmpSol.maxDeviation = currIter->getSolutionPointDeviation(0);
         env->primalSolver->addFixedNLPCandidate(tmpSol.point, E_PrimalNLPSource::FirstSolutionNewDualBound,
             tmpSol.objectiveValue, tmpSol.iterFound, tmpSol.maxDeviation);
     }
@@ -104,12 +105,14 @@ void TaskSelectPrimalFixedNLPPointsFromSolutionPool::run()
     else if(callNLPSolver && userSetting == static_cast<int>(ES_PrimalNLPFixedPoint::FirstSolution))
     {
         auto tmpSol = allSolutions.at(0);
+        tmpSol.maxDeviation = currIter->getSolutionPointDeviation(0);
         env->primalSolver->addFixedNLPCandidate(tmpSol.point, E_PrimalNLPSource::FirstSolution, tmpSol.objectiveValue,
             tmpSol.iterFound, tmpSol.maxDeviation);
     }
     else if(callNLPSolver && userSetting == static_cast<int>(ES_PrimalNLPFixedPoint::FirstAndFeasibleSolutions))
     {
         auto tmpSol = allSolutions.at(0);
+        tmpSol.maxDeviation = currIter->getSolutionPointDeviation(0);
         env->primalSolver->addFixedNLPCandidate(tmpSol.point, E_PrimalNLPSource::FirstSolution, tmpSol.objectiveValue,
             tmpSol.iterFound, tmpSol.maxDeviation);
 
@@ -118,6 +121,7 @@ void TaskSelectPrimalFixedNLPPointsFromSolutionPool::run()
         if(smallestDevSolIdx != 0)
         {
             tmpSol = allSolutions.at(smallestDevSolIdx);
+            tmpSol.maxDeviation = currIter->getSolutionPointDeviation(smallestDevSolIdx);
             env->primalSolver->addFixedNLPCandidate(tmpSol.point, E_PrimalNLPSource::FeasibleSolution,
                 tmpSol.objectiveValue, tmpSol.iterFound, tmpSol.maxDeviation);
         }
@@ -126,6 +130,7 @@ void TaskSelectPrimalFixedNLPPointsFromSolutionPool::run()
         && userSettingStrategy == static_cast<int>(ES_PrimalNLPStrategy::IterationOrTimeAndAllFeasibleSolutions))
     {
         auto tmpSol = allSolutions.at(0);
+        tmpSol.maxDeviation = currIter->getSolutionPointDeviation(0);
 
         env->primalSolver->addFixedNLPCandidate(tmpSol.point, E_PrimalNLPSource::FirstSolution, tmpSol.objectiveValue,
             tmpSol.iterFound, tmpSol.maxDeviation);
@@ -133,6 +138,7 @@ void TaskSelectPrimalFixedNLPPointsFromSolutionPool::run()
         for(size_t i = 1; i < allSolutions.size(); i++)
         {
             auto tmpSol = allSolutions.at(i);
+            tmpSol.maxDeviation = currIter->getSolutionPointDeviation(i);
 
             if(tmpSol.maxDeviation.value
                 <= env->settings->getSetting<double>("Tolerance.NonlinearConstraint", "Primal"))
@@ -145,6 +151,7 @@ void TaskSelectPrimalFixedNLPPointsFromSolutionPool::run()
     else if(callNLPSolver && userSetting == static_cast<int>(ES_PrimalNLPFixedPoint::AllSolutions))
     {
         auto tmpSol = allSolutions.at(0);
+        tmpSol.maxDeviation = currIter->getSolutionPointDeviation(0);
 
         env->primalSolver->addFixedNLPCandidate(tmpSol.point, E_PrimalNLPSource::FirstSolution, tmpSol.objectiveValue,
             tmpSol.iterFound, tmpSol.maxDeviation);
@@ -152,6 +159,7 @@ void TaskSelectPrimalFixedNLPPointsFromSolutionPool::run()
         for(size_t i = 1; i < allSolutions.size(); i++)
         {
             tmpSol = allSolutions.at(i);
+            tmpSol.maxDeviation = currIter->getSolutionPointDeviation(i);
 
             if(tmpSol.maxDeviation.value
                 <= env->settings->getSetting<double>("Tolerance.NonlinearConstraint", "Primal"))
@@ -55,7 +55,7 @@ void TaskSolveIteration::run()
 
     // Sets the iteration time limit
     auto timeLim = env->settings->getSetting<double>("TimeLimit", "Termination") - env->timing->getElapsedTime("Total");
-    env->dualSolver->MIPSolver->setTimeLimit(timeLim);
+    env->dualSolver->MIPSolver->setTimeLimit(std::min(timeLim, env->dualSolver->iterationTimeLimit));
 
     if(env->dualSolver->useCutOff)
     {
@@ -150,6 +150,7 @@ void TaskSolveIteration::run()
     }
 
     currIter->solutionStatus = solStatus;
+    currIter->usedMIPRelativeGap = env->dualSolver->MIPSolver->getRelativeGap();
 
     env->output->outputDebug(fmt::format("        Dual problem solved with return code: {}", (int)solStatus));
 
@@ -197,11 +198,10 @@ void TaskSolveIteration::run()
 
         if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
         {
-            auto mostDevConstr = env->reformulatedProblem->getMaxNumericConstraintValue(
-                sols.at(0).point, env->reformulatedProblem->nonlinearConstraints);
+            auto mostDevConstr = currIter->getSolutionPointDeviation(0);
 
-            currIter->maxDeviationConstraint = mostDevConstr.constraint->index;
-            currIter->maxDeviation = mostDevConstr.normalizedValue;
+            currIter->maxDeviationConstraint = mostDevConstr.index;
+            currIter->maxDeviation = mostDevConstr.value;
 
             if(env->settings->getSetting<bool>("Debug.Enable", "Output"))
             {
@@ -235,7 +235,10 @@ void TaskSolveIteration::run()
                     currIter->iterationNumber, false };
                 env->dualSolver->addDualSolutionCandidate(sol);
 
-                if(currIter->solutionStatus == E_ProblemSolutionStatus::Optimal)
+                // The objective value is only a valid bound if the problem was solved with the termination gap
+                if(currIter->solutionStatus == E_ProblemSolutionStatus::Optimal
+                    && currIter->usedMIPRelativeGap
+                        <= env->settings->getSetting<double>("ObjectiveGap.Relative", "Termination"))
                 {
                     DualSolution sol = { sols.at(0).point, E_DualSolutionSource::MIPSolutionOptimal,
                         currIter->objectiveValue, currIter->iterationNumber, false };
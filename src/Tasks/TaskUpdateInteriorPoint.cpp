@@ -12,6 +12,7 @@
 
 #include "../DualSolver.h"
 #include "../Output.h"
+#include "../PrimalSolver.h"
 #include "../Results.h"
 #include "../Settings.h"
 #include "../Timing.h"
@@ -27,6 +28,9 @@ TaskUpdateInteriorPoint::~TaskUpdateInteriorPoint() = default;
 
 void TaskUpdateInteriorPoint::run()
 {
+    // The interior points may be used for cut generation, and the primal solutions updated, in other threads
+    std::scoped_lock lock(env->primalSolver->primalSolutionMutex, env->dualSolver->cutGenerationMutex);
+
     // If we do not yet have a valid primal solution we can't do anything
     if(!env->results->hasPrimalSolution())
         return;
@@ -0,0 +1,268 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "ThreadPool.h"
+
+#include "Settings.h"
+#include "TaskHandler.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace SHOT
+{
+
+// The index of the queue of the current worker thread, or -1 if the thread is not a worker
+static thread_local int currentQueueIndex = -1;
+
+ThreadPool::ThreadPool(EnvironmentPtr envPtr) : env(envPtr) { }
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        isStopping = true;
+    }
+
+    sleepCondition.notify_all();
+
+    for(auto& T : workers)
+        T.join();
+}
+
+int ThreadPool::getNumberOfThreads()
+{
+    int numberOfThreads = 0;
+
+    if(auto sharedEnv = env.lock(); sharedEnv && sharedEnv->settings)
+        numberOfThreads = sharedEnv->settings->getSetting<int>("MIP.NumberOfThreads", "Dual");
+
+    if(numberOfThreads <= 0)
+        numberOfThreads = std::max(1, (int)std::thread::hardware_concurrency());
+
+    return (numberOfThreads);
+}
+
+bool ThreadPool::isCancelled()
+{
+    if(auto sharedEnv = env.lock(); sharedEnv && sharedEnv->tasks)
+        return (sharedEnv->tasks->isCancelled());
+
+    return (false);
+}
+
+void ThreadPool::start()
+{
+    // The calling thread also does work, so one thread less is started
+    size_t numberOfWorkers = getNumberOfThreads() - 1;
+
+    queues.reserve(std::max((size_t)1, numberOfWorkers));
+
+    for(size_t i = 0; i < std::max((size_t)1, numberOfWorkers); i++)
+        queues.push_back(std::make_unique<TaskQueue>());
+
+    workers.reserve(numberOfWorkers);
+
+    for(size_t i = 0; i < numberOfWorkers; i++)
+        workers.emplace_back([this, i]() { runWorker(i); });
+}
+
+void ThreadPool::runWorker(size_t queueIndex)
+{
+    currentQueueIndex = (int)queueIndex;
+
+    while(true)
+    {
+        if(runQueuedTask())
+            continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepCondition.wait(lock, [this]() { return (isStopping || numberOfQueuedTasks > 0); });
+
+        if(isStopping)
+            return;
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+    std::call_once(startFlag, [this]() { start(); });
+
+    // Tasks created by a worker are put in its own queue, the others are spread over the queues
+    size_t queueIndex
+        = (currentQueueIndex >= 0 && (size_t)currentQueueIndex < queues.size()) ? currentQueueIndex : nextQueue++;
+
+    auto& queue = *queues[queueIndex % queues.size()];
+
+    {
+        // The count is increased together with the push, so that it cannot be decreased by a worker before it is
+        // increased
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+        numberOfQueuedTasks++;
+    }
+
+    {
+        // Taking the lock makes sure that a worker checking the count is either waiting or sees the new task
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+
+    sleepCondition.notify_one();
+}
+
+bool ThreadPool::runQueuedTask()
+{
+    if(numberOfQueuedTasks == 0 || queues.size() == 0)
+        return (false);
+
+    std::function<void()> task;
+
+    // A worker takes the newest task from its own queue, and the oldest one from the other queues
+    size_t firstQueue = (currentQueueIndex >= 0) ? currentQueueIndex : 0;
+
+    for(size_t i = 0; i < queues.size() && !task; i++)
+    {
+        auto& queue = *queues[(firstQueue + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if(queue.tasks.empty())
+            continue;
+
+        if(i == 0 && currentQueueIndex >= 0)
+        {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+        else
+        {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+
+        numberOfQueuedTasks--;
+    }
+
+    if(!task)
+        return (false);
+
+    task();
+
+    return (true);
+}
+
+void ThreadPool::parallelFor(
+    size_t numberOfElements, const std::function<void(size_t)>& function, size_t minimumElementsPerThread)
+{
+    size_t maximumNumberOfThreads = numberOfElements / std::max((size_t)1, minimumElementsPerThread);
+    size_t numberOfThreads = std::min((size_t)getNumberOfThreads(), maximumNumberOfThreads);
+
+    if(numberOfThreads <= 1)
+    {
+        for(size_t i = 0; i < numberOfElements; i++)
+            function(i);
+
+        return;
+    }
+
+    std::atomic<size_t> nextIndex = 0;
+
+    auto worker = [&]() {
+        for(size_t i = nextIndex++; i < numberOfElements; i = nextIndex++)
+        {
+            try
+            {
+                function(i);
+            }
+            catch(...)
+            {
+                nextIndex = numberOfElements; // The remaining elements are skipped
+                throw;
+            }
+        }
+    };
+
+    TaskGroup group(*this);
+
+    // The calling thread runs the tasks in the group while waiting, so it is one of the threads used
+    for(size_t i = 0; i < numberOfThreads; i++)
+        group.run(worker);
+
+    group.wait();
+}
+
+TaskGroup::~TaskGroup()
+{
+    try
+    {
+        wait();
+    }
+    catch(...)
+    {
+        // Exceptions are only rethrown when wait() is called explicitly
+    }
+}
+
+void TaskGroup::run(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        numberOfPendingTasks++;
+    }
+
+    pool.submit([this, task = std::move(task)]() {
+        try
+        {
+            task();
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex);
+
+            if(!exception)
+                exception = std::current_exception();
+        }
+
+        // Notified while holding the lock, since the group may be destroyed as soon as the waiting thread sees that
+        // there are no pending tasks
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        numberOfPendingTasks--;
+        pendingCondition.notify_all();
+    });
+}
+
+void TaskGroup::wait()
+{
+    while(true)
+    {
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex);
+
+            if(numberOfPendingTasks == 0)
+                break;
+        }
+
+        // Helps with the queued tasks, which may include the ones in this group
+        if(pool.runQueuedTask())
+            continue;
+
+        std::unique_lock<std::mutex> lock(pendingMutex);
+        pendingCondition.wait_for(
+            lock, std::chrono::milliseconds(1), [this]() { return (numberOfPendingTasks == 0); });
+    }
+
+    if(exception)
+    {
+        auto currentException = exception;
+        exception = nullptr;
+        std::rethrow_exception(currentException);
+    }
+}
+
+} // namespace SHOT
@@ -0,0 +1,105 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+#include "Environment.h"
+#include "Structs.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SHOT
+{
+
+// The worker threads shared by all parallel work in the solver. The number of threads is given by the setting
+// MIP.NumberOfThreads, so that the parallel parts of SHOT use the same cores as the MIP solver instead of starting
+// threads of their own. The workers are started on first use. Each worker has its own task queue, and takes tasks from
+// the queues of the other workers when its own is empty.
+class ThreadPool
+{
+public:
+    ThreadPool(EnvironmentPtr envPtr);
+    ~ThreadPool();
+
+    // Calls the function for each index in [0, numberOfElements) on the workers and the calling thread, so that each
+    // thread gets at least minimumElementsPerThread elements. The first exception thrown by the function is rethrown in
+    // the calling thread, and the remaining elements are then skipped.
+    void parallelFor(
+        size_t numberOfElements, const std::function<void(size_t)>& function, size_t minimumElementsPerThread = 1);
+
+    // The total number of threads used, including the calling thread
+    int getNumberOfThreads();
+
+    // Whether the solver has been terminated or has reached its time limit, in which case tasks should return early
+    bool isCancelled();
+
+private:
+    struct TaskQueue
+    {
+        std::deque<std::function<void()>> tasks;
+        std::mutex mutex;
+    };
+
+    // Not kept alive by the pool, since the environment owns the pool
+    std::weak_ptr<Environment> env;
+
+    std::vector<std::unique_ptr<TaskQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::once_flag startFlag;
+    std::atomic<bool> isStopping = false;
+    std::atomic<size_t> numberOfQueuedTasks = 0;
+    std::atomic<size_t> nextQueue = 0;
+
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+
+    void start();
+    void runWorker(size_t queueIndex);
+
+    void submit(std::function<void()> task);
+
+    // Runs one queued task, preferably from the queue of the calling worker. Returns false if there were none.
+    bool runQueuedTask();
+
+    friend class TaskGroup;
+};
+
+// A group of tasks run on the thread pool that can be waited for. The waiting thread runs queued tasks while waiting,
+// so task groups can be used from within other tasks.
+class TaskGroup
+{
+public:
+    TaskGroup(ThreadPool& threadPool) : pool(threadPool) {};
+    ~TaskGroup();
+
+    void run(std::function<void()> task);
+
+    // Waits for all tasks in the group, and rethrows the first exception thrown by any of them
+    void wait();
+
+private:
+    ThreadPool& pool;
+
+    size_t numberOfPendingTasks = 0;
+    std::exception_ptr exception;
+
+    std::mutex pendingMutex;
+    std::condition_variable pendingCondition;
+};
+
+} // namespace SHOT
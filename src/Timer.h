@@ -10,7 +10,9 @@
 
 #pragma once
 #include <chrono>
+#include <map>
 #include <string>
+#include <thread>
 
 class Timer
 {
@@ -20,60 +22,56 @@ public:
 
     Timer(std::string timerName)
     {
-        restart();
-        isRunning = false;
+        timeElapsed = 0.0;
         description = "";
         name = timerName;
     }
 
     Timer(std::string timerName, std::string desc)
     {
-        restart();
-        isRunning = false;
+        timeElapsed = 0.0;
         description = desc;
         name = timerName;
     }
 
-    std::chrono::time_point<std::chrono::high_resolution_clock> lastStart;
-
     inline double elapsed()
     {
-        if(isRunning)
+        double totalTime = timeElapsed;
+        auto now = std::chrono::high_resolution_clock::now();
+
+        for(auto& S : lastStarts)
         {
-            std::chrono::duration<double> dur = std::chrono::high_resolution_clock::now() - lastStart;
-            double tmpTime = dur.count();
-            return (timeElapsed + tmpTime);
+            std::chrono::duration<double> dur = now - S.second;
+            totalTime += dur.count();
         }
-        return (timeElapsed);
+
+        return (totalTime);
     }
 
     inline void restart()
     {
-        isRunning = true;
         timeElapsed = 0.0;
-        lastStart = std::chrono::high_resolution_clock::now();
+        lastStarts.clear();
+        lastStarts[std::this_thread::get_id()] = std::chrono::high_resolution_clock::now();
     }
 
     inline void stop()
     {
-        if(!isRunning)
+        auto lastStart = lastStarts.find(std::this_thread::get_id());
+
+        if(lastStart == lastStarts.end())
             return;
 
-        std::chrono::duration<double> dur = std::chrono::high_resolution_clock::now() - lastStart;
+        std::chrono::duration<double> dur = std::chrono::high_resolution_clock::now() - lastStart->second;
         double tmpTime = dur.count();
         timeElapsed = timeElapsed + tmpTime;
-        isRunning = false;
+        lastStarts.erase(lastStart);
     }
 
     inline void start()
     {
-        if(isRunning)
-        {
-            return;
-        }
-
-        isRunning = true;
-        lastStart = std::chrono::high_resolution_clock::now();
+        // Does nothing if the timer is already running in this thread
+        lastStarts.emplace(std::this_thread::get_id(), std::chrono::high_resolution_clock::now());
     }
 
     std::string description;
@@ -81,5 +79,8 @@ public:
 
 private:
     double timeElapsed;
-    bool isRunning;
+
+    // The timer can be running in several threads at the same time, e.g., in the callbacks of the MIP solver. Each
+    // thread has its own start time, and the times of all threads are added up.
+    std::map<std::thread::id, std::chrono::time_point<std::chrono::high_resolution_clock>> lastStarts;
 };
@@ -13,6 +13,7 @@
 #include "Timer.h"
 
 #include <algorithm>
+#include <mutex>
 #include <vector>
 
 namespace SHOT
@@ -25,10 +26,17 @@ public:
 
     inline ~Timing() { timers.clear(); }
 
-    inline void createTimer(std::string name, std::string description) { timers.emplace_back(name, description); }
+    inline void createTimer(std::string name, std::string description)
+    {
+        std::lock_guard<std::mutex> lock(timersMutex);
+
+        timers.emplace_back(name, description);
+    }
 
     inline void startTimer(std::string name)
     {
+        std::lock_guard<std::mutex> lock(timersMutex);
+
         auto timer = std::find_if(timers.begin(), timers.end(), [name](Timer const& T) { return (T.name == name); });
 
         if(timer == timers.end())
@@ -42,6 +50,8 @@ public:
 
     inline void stopTimer(std::string name)
     {
+        std::lock_guard<std::mutex> lock(timersMutex);
+
         auto timer = std::find_if(timers.begin(), timers.end(), [name](Timer const& T) { return (T.name == name); });
 
         if(timer == timers.end())
@@ -55,6 +65,8 @@ public:
 
     inline void restartTimer(std::string name)
     {
+        std::lock_guard<std::mutex> lock(timersMutex);
+
         auto timer = std::find_if(timers.begin(), timers.end(), [name](Timer const& T) { return (T.name == name); });
 
         if(timer == timers.end())
@@ -68,6 +80,8 @@ public:
 
     inline double getElapsedTime(std::string name)
     {
+        std::lock_guard<std::mutex> lock(timersMutex);
+
         auto timer = std::find_if(timers.begin(), timers.end(), [name](Timer const& T) { return (T.name == name); });
 
         if(timer == timers.end())
@@ -83,6 +97,9 @@ public:
 
 private:
     EnvironmentPtr env;
+
+    // The timers may be started and stopped from several threads, e.g., in the callbacks of the MIP solver
+    std::mutex timersMutex;
 };
 
 } // namespace SHOT
\ No newline at end of file
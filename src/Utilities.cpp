@@ -783,5 +783,4 @@ std::string createTemporaryDirectory(std::string filePrefix, std::string folder)
 
     return (path.string());
 }
-
-} // namespace SHOT::Utilities
\ No newline at end of file
+} // namespace SHOT::Utilities
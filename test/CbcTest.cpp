@@ -17,7 +17,11 @@
 
 #include "../src/Model/Problem.h"
 
+#include "../src/MIPSolver/MIPSolverCbc.h"
+
+#include <cmath>
 #include <iostream>
+#include <tuple>
 
 using namespace SHOT;
 
@@ -115,6 +119,152 @@ bool CbcTerminationCallbackTest(std::string filename)
     return (true);
 }
 
+bool CbcTestHyperplaneCleanup()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+
+    solver->updateSetting("Console.LogLevel", "Output", static_cast<int>(E_LogLevel::Error));
+
+    auto MIPSolver = std::make_unique<MIPSolverCbc>(env);
+    MIPSolver->initializeProblem();
+    MIPSolver->addVariable("x0", E_VariableType::Real, 0.0, 10.0, 0.0);
+    MIPSolver->addVariable("x1", E_VariableType::Real, -2.0, 3.0, 0.0);
+    MIPSolver->addVariable("x2", E_VariableType::Real, -1e8, 1e8, 0.0);
+
+    // The cuts are on the form sum(a_i*x_i) + constant <= 0
+    auto calculateValue = [](const std::map<int, double>& elements, double constant, const VectorDouble& point) {
+        double value = constant;
+
+        for(auto& E : elements)
+            value += E.second * point[E.first];
+
+        return (value);
+    };
+
+    // A tiny coefficient is removed and replaced with its smallest value over the variable bounds, so the cut is
+    // never tighter than the original one
+    std::map<int, double> originalElements = { { 0, 1.0 }, { 1, 1e-10 } };
+    double originalConstant = -1.0;
+
+    for(double coefficient : { 1e-10, -1e-10 })
+    {
+        originalElements[1] = coefficient;
+
+        auto elements = originalElements;
+        double constant = originalConstant;
+
+        if(!MIPSolver->postProcessHyperplaneTerms(elements, constant) || elements.count(1) > 0)
+        {
+            std::cout << "Small coefficient " << coefficient << " not removed from hyperplane.\n";
+            passed = false;
+            continue;
+        }
+
+        for(double x0 : { 0.0, 10.0 })
+        {
+            for(double x1 : { -2.0, 3.0 })
+            {
+                VectorDouble point = { x0, x1, 0.0 };
+
+                // Allows for the rounding error when the constant is moved
+                if(calculateValue(elements, constant, point)
+                    > calculateValue(originalElements, originalConstant, point) + 1e-12)
+                {
+                    std::cout << "Hyperplane tightened when removing coefficient " << coefficient << " in point ("
+                              << x0 << ", " << x1 << ").\n";
+                    passed = false;
+                }
+            }
+        }
+    }
+
+    // A tiny coefficient is kept if removing it changes the constant too much
+    {
+        std::map<int, double> elements = { { 0, 1.0 }, { 2, 1e-10 } };
+        double constant = -1.0;
+
+        if(!MIPSolver->postProcessHyperplaneTerms(elements, constant) || elements.count(2) == 0 || constant != -1.0)
+        {
+            std::cout << "Small coefficient for variable with large bounds removed from hyperplane.\n";
+            passed = false;
+        }
+    }
+
+    // Large coefficients are scaled with a power of two, so the scaled cut has exactly the same values
+    {
+        originalElements = { { 0, 3e4 }, { 1, 1.5e3 + 0.1 } };
+        originalConstant = 7e3 + 0.3;
+
+        auto elements = originalElements;
+        double constant = originalConstant;
+
+        if(!MIPSolver->postProcessHyperplaneTerms(elements, constant))
+        {
+            std::cout << "Hyperplane with large coefficients rejected.\n";
+            passed = false;
+        }
+        else
+        {
+            double scalingFactor = originalElements[0] / elements[0];
+            VectorDouble point = { 0.3, 1.7, 0.0 };
+
+            if(scalingFactor != std::ldexp(1.0, std::ilogb(scalingFactor)) || elements[0] > 2.0 || elements[0] < 1.0
+                || elements[1] * scalingFactor != originalElements[1] || constant * scalingFactor != originalConstant
+                || calculateValue(elements, constant, point) * scalingFactor
+                    != calculateValue(originalElements, originalConstant, point))
+            {
+                std::cout << "Hyperplane not scaled exactly with a power of two.\n";
+                passed = false;
+            }
+        }
+    }
+
+    // Hyperplanes are rejected if the coefficient range is larger than the maximum range 1e12
+    for(auto [coefficient, accept] : { std::make_pair(2e-12, true), std::make_pair(5e-13, false) })
+    {
+        std::map<int, double> elements = { { 0, 1.0 }, { 2, coefficient } };
+        double constant = -1.0;
+
+        if(MIPSolver->postProcessHyperplaneTerms(elements, constant) != accept)
+        {
+            std::cout << "Hyperplane with coefficient range " << 1.0 / coefficient << " not "
+                      << (accept ? "accepted" : "rejected") << ".\n";
+            passed = false;
+        }
+    }
+
+    // Hyperplanes are rejected if the absolute value of the constant is larger than 1e15 after scaling
+    for(auto [coefficient, constant, accept] : { std::make_tuple(1.0, 5e14, true), std::make_tuple(1.0, -2e15, false),
+            std::make_tuple(4096.0, 4e17, true), std::make_tuple(4096.0, 8e18, false) })
+    {
+        std::map<int, double> elements = { { 0, coefficient } };
+
+        if(MIPSolver->postProcessHyperplaneTerms(elements, constant) != accept)
+        {
+            std::cout << "Hyperplane with coefficient " << coefficient << " and constant " << constant << " not "
+                      << (accept ? "accepted" : "rejected") << ".\n";
+            passed = false;
+        }
+    }
+
+    // Hyperplanes without nonzero coefficients are always rejected
+    {
+        std::map<int, double> elements = { { 0, 0.0 } };
+        double constant = -1.0;
+
+        if(MIPSolver->postProcessHyperplaneTerms(elements, constant))
+        {
+            std::cout << "Hyperplane without nonzero coefficients accepted.\n";
+            passed = false;
+        }
+    }
+
+    return passed;
+}
+
 int CbcTest(int argc, char* argv[])
 {
     int defaultchoice = 1;
@@ -149,6 +299,11 @@ int CbcTest(int argc, char* argv[])
         passed = CbcTest1("data/meanvarxsc.osil");
         std::cout << "Finished test to solve problem with semicont. variables." << std::endl;
         break;
+    case 4:
+        std::cout << "Starting test of the cleanup of hyperplanes:" << std::endl;
+        passed = CbcTestHyperplaneCleanup();
+        std::cout << "Finished test of the cleanup of hyperplanes." << std::endl;
+        break;
     default:
         passed = false;
         std::cout << "Test #" << choice << " does not exist!\n";
@@ -0,0 +1,285 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "../src/Solver.h"
+#include "../src/DualSolver.h"
+#include "../src/Environment.h"
+#include "../src/Iteration.h"
+#include "../src/PointStore.h"
+#include "../src/Results.h"
+#include "../src/Settings.h"
+#include "../src/Structs.h"
+#include "../src/Utilities.h"
+
+#include "../src/Tasks/TaskAddHyperplanes.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace SHOT;
+
+bool DualTestCutSelection();
+bool DualTestPointStore();
+
+int DualTest(int argc, char* argv[])
+{
+    int defaultchoice = 1;
+
+    int choice = defaultchoice;
+
+    if(argc > 1)
+    {
+        if(sscanf(argv[1], "%d", &choice) != 1)
+        {
+            printf("Couldn't parse that input as a number\n");
+            return -1;
+        }
+    }
+
+    bool passed = true;
+
+    switch(choice)
+    {
+    case 1:
+        std::cout << "Starting test of the cut selection:" << std::endl;
+        passed = DualTestCutSelection();
+        std::cout << "Finished test of the cut selection." << std::endl;
+        break;
+    case 2:
+        std::cout << "Starting test of the point store:" << std::endl;
+        passed = DualTestPointStore();
+        std::cout << "Finished test of the point store." << std::endl;
+        break;
+    default:
+        passed = false;
+        std::cout << "Test #" << choice << " does not exist!\n";
+    }
+
+    if(passed)
+        return 0;
+    else
+        return -1;
+}
+
+bool DualTestCutSelection()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+
+    // The cuts are selected based on the solution point of the previous iteration
+    SHOT::SolutionPoint solutionPoint;
+    solutionPoint.point = { 1.0, 1.0 };
+
+    env->results->createIteration();
+    env->results->getCurrentIteration()->solutionPoints.push_back(solutionPoint);
+    env->results->createIteration();
+
+    // The cuts are on the form sum(a_i*x_i) + constant <= 0
+    auto addCut = [&](std::map<int, double> coefficients, double constant) {
+        SHOT::Hyperplane hyperplane;
+        hyperplane.sourceConstraintIndex = 0;
+        hyperplane.source = SHOT::E_HyperplaneSource::MIPOptimalRootsearch;
+        hyperplane.terms = std::make_pair(coefficients, constant);
+        env->dualSolver->hyperplaneWaitingList.push_back(hyperplane);
+    };
+
+    addCut({ { 0, 1.0 }, { 1, 1.0 } }, -1.0); // 0: violated, but almost parallel to the more efficient cut 4
+    addCut({ { 0, 2.0 }, { 1, 2.0 } }, -3.0); // 1: parallel to and dominated by cut 0
+    addCut({ { 0, 1.0 } }, -0.5); // 2: violated
+    addCut({ { 1, 1.0 } }, -2.0); // 3: not violated, but not parallel to any of the selected cuts
+    addCut({ { 0, 1.0 }, { 1, 1.0005 } }, -0.9); // 4: the most efficient cut
+
+    // Objective cuts are always selected
+    SHOT::Hyperplane objectiveHyperplane;
+    objectiveHyperplane.sourceConstraintIndex = -1;
+    objectiveHyperplane.source = SHOT::E_HyperplaneSource::ObjectiveRootsearch;
+    objectiveHyperplane.isObjectiveHyperplane = true;
+    env->dualSolver->hyperplaneWaitingList.push_back(objectiveHyperplane); // 5
+
+    auto selectedHyperplanes = TaskAddHyperplanes(env).selectHyperplanes();
+
+    std::vector<int> expectedHyperplanes = { 5, 4, 2, 3 };
+
+    std::cout << "Selected hyperplanes:";
+
+    for(auto& I : selectedHyperplanes)
+        std::cout << ' ' << I;
+
+    std::cout << " (should be 5 4 2 3).\n";
+
+    if(selectedHyperplanes != expectedHyperplanes)
+        passed = false;
+
+    // Without the selection all hyperplanes are added, the most recent ones first
+    env->settings->updateSetting("HyperplaneCuts.Selection.Use", "Dual", false);
+
+    selectedHyperplanes = TaskAddHyperplanes(env).selectHyperplanes();
+    expectedHyperplanes = { 5, 4, 3, 2, 1, 0 };
+
+    if(selectedHyperplanes != expectedHyperplanes)
+    {
+        std::cout << "All hyperplanes not selected when the selection is disabled.\n";
+        passed = false;
+    }
+
+    return passed;
+}
+
+bool DualTestPointStore()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+
+    auto pointStore = std::make_shared<PointStore>(env);
+
+    // Equal points share the same stored copy
+    auto firstHandle = pointStore->add(VectorDouble({ 1.0, 2.0, 3.0 }));
+    auto secondHandle = pointStore->add(VectorDouble({ 1.0, 2.0, 3.0 }));
+    auto otherHandle = pointStore->add(VectorDouble({ 1.0, 2.0, 4.0 }));
+
+    if(!firstHandle.isSameAs(secondHandle) || firstHandle.isSameAs(otherHandle))
+    {
+        std::cout << "Equal points not stored once.\n";
+        passed = false;
+    }
+
+    // A handle to an equal point is replaced with the stored one, and a new handle is stored without copying
+    auto unstoredHandle = PointHandle(VectorDouble({ 1.0, 2.0, 3.0 }));
+    auto newHandle = PointHandle(VectorDouble({ 5.0, 6.0, 7.0 }));
+
+    if(!pointStore->add(unstoredHandle).isSameAs(firstHandle) || !pointStore->add(newHandle).isSameAs(newHandle))
+    {
+        std::cout << "Point handles not stored correctly.\n";
+        passed = false;
+    }
+
+    // Points with the same hash are only shared if they are equal. The hash is a weighted sum of the elements, so the
+    // points (w_1, 0) and (0, w_0), where w_i are the weights, have the same hash.
+    double firstWeight = Utilities::calculateHash(VectorDouble({ 1.0, 0.0 }));
+    double secondWeight = Utilities::calculateHash(VectorDouble({ 0.0, 1.0 }));
+
+    auto firstCollidingHandle = pointStore->add(VectorDouble({ secondWeight, 0.0 }));
+    auto secondCollidingHandle = pointStore->add(VectorDouble({ 0.0, firstWeight }));
+
+    if(Utilities::calculateHash(firstCollidingHandle.get()) != Utilities::calculateHash(secondCollidingHandle.get()))
+    {
+        std::cout << "Points with the same hash not created.\n";
+        passed = false;
+    }
+
+    if(firstCollidingHandle.isSameAs(secondCollidingHandle) || secondCollidingHandle[1] != firstWeight)
+    {
+        std::cout << "Different points with the same hash are shared.\n";
+        passed = false;
+    }
+
+    // The handles remain valid when the store grows, and unused points are removed when cleaning up
+    const double* firstValues = firstHandle.get().data();
+    std::vector<PointHandle> handles;
+
+    for(int i = 0; i < 5000; i++)
+    {
+        auto handle = pointStore->add(VectorDouble({ (double)i, -1.0, 0.5 * i }));
+
+        if(i % 2 == 0)
+            handles.push_back(handle);
+    }
+
+    if(firstHandle.get().data() != firstValues || firstHandle.get() != VectorDouble({ 1.0, 2.0, 3.0 })
+        || !pointStore->add(VectorDouble({ 1.0, 2.0, 3.0 })).isSameAs(firstHandle))
+    {
+        std::cout << "Point handle not valid after adding more points.\n";
+        passed = false;
+    }
+
+    for(size_t i = 0; i < handles.size(); i++)
+    {
+        if(handles[i].get() != VectorDouble({ 2.0 * i, -1.0, 1.0 * i }))
+        {
+            std::cout << "Point handle " << i << " not valid after adding more points.\n";
+            passed = false;
+            break;
+        }
+    }
+
+    // The points 1-3, the two colliding ones, and the 2500 kept in the loop
+    if(pointStore->size() != 2505)
+    {
+        std::cout << "Number of stored points is " << pointStore->size() << " (should be 2505).\n";
+        passed = false;
+    }
+
+    handles.clear();
+
+    if(pointStore->size() != 5)
+    {
+        std::cout << "Unused points not removed, number of stored points is " << pointStore->size() << ".\n";
+        passed = false;
+    }
+
+    // Points added concurrently are still only stored once
+    auto concurrentPointStore = std::make_shared<PointStore>(env);
+
+    const int numberOfThreads = 8;
+    const int numberOfPoints = 200;
+
+    std::vector<std::vector<PointHandle>> threadHandles(numberOfThreads);
+    std::vector<std::thread> threads;
+
+    for(int t = 0; t < numberOfThreads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            for(int repetition = 0; repetition < 3; repetition++)
+            {
+                for(int i = 0; i < numberOfPoints; i++)
+                {
+                    // The threads add the points in different orders
+                    int index = (i * (2 * t + 1) + t) % numberOfPoints;
+                    auto handle = concurrentPointStore->add(VectorDouble({ (double)index, 1.0 / (index + 1) }));
+
+                    if(repetition == 0)
+                        threadHandles[t].push_back(handle);
+                }
+            }
+        });
+    }
+
+    for(auto& T : threads)
+        T.join();
+
+    for(int t = 0; t < numberOfThreads; t++)
+    {
+        for(int i = 0; i < numberOfPoints; i++)
+        {
+            int index = (i * (2 * t + 1) + t) % numberOfPoints;
+            auto storedHandle = concurrentPointStore->add(VectorDouble({ (double)index, 1.0 / (index + 1) }));
+
+            if(!threadHandles[t][i].isSameAs(storedHandle))
+            {
+                std::cout << "Point " << index << " added concurrently is stored more than once.\n";
+                passed = false;
+            }
+        }
+    }
+
+    if(concurrentPointStore->size() != numberOfPoints)
+    {
+        std::cout << "Number of points added concurrently is " << concurrentPointStore->size() << " (should be "
+                  << numberOfPoints << ").\n";
+        passed = false;
+    }
+
+    return passed;
+}
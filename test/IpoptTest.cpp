@@ -22,6 +22,8 @@
 
 #include "../src/NLPSolver/NLPSolverIpoptRelaxed.h"
 
+#include <tuple>
+
 using namespace SHOT;
 
 bool IpoptTest1()
@@ -237,6 +239,62 @@ bool IpoptTest2()
     return (passed);
 }
 
+bool IpoptTestPipelined(const std::string& problemFile)
+{
+    bool passed = true;
+
+    // The fixed NLP problems are solved with Ipopt in a separate thread while the next MIP problem is solved, which
+    // should give the same result as when they are solved in sequence
+    auto solve = [&](bool pipelined) {
+        auto solver = std::make_unique<SHOT::Solver>();
+
+        solver->updateSetting("Console.LogLevel", "Output", static_cast<int>(E_LogLevel::Off));
+        solver->updateSetting("TreeStrategy", "Dual", static_cast<int>(ES_TreeStrategy::MultiTree));
+        solver->updateSetting("TreeStrategy.Multi.Pipelined", "Dual", pipelined);
+        solver->updateSetting("FixedInteger.Solver", "Primal", static_cast<int>(ES_PrimalNLPSolver::Ipopt));
+
+        if(!solver->setProblem(problemFile))
+        {
+            std::cout << "Could not read problem " << problemFile << ".\n";
+            passed = false;
+        }
+        else
+        {
+            solver->solveProblem();
+        }
+
+        return (std::make_tuple(solver->hasPrimalSolution(), solver->getPrimalBound(),
+            solver->getModelReturnStatus(), solver->getTerminationReason()));
+    };
+
+    auto [sequentialHasSolution, sequentialPrimalBound, sequentialStatus, sequentialTermination] = solve(false);
+    auto [pipelinedHasSolution, pipelinedPrimalBound, pipelinedStatus, pipelinedTermination] = solve(true);
+
+    std::cout << "Primal bound when solved in sequence: " << sequentialPrimalBound << '\n';
+    std::cout << "Primal bound when pipelined: " << pipelinedPrimalBound << '\n';
+
+    if(!sequentialHasSolution || !pipelinedHasSolution)
+    {
+        std::cout << "No primal solution found.\n";
+        passed = false;
+    }
+    else if(std::abs(sequentialPrimalBound - pipelinedPrimalBound)
+        > 1e-3 * std::max(1.0, std::abs(sequentialPrimalBound)))
+    {
+        std::cout << "The primal bounds differ.\n";
+        passed = false;
+    }
+
+    if(sequentialStatus != pipelinedStatus || sequentialTermination != pipelinedTermination)
+    {
+        std::cout << "The termination differs: " << (int)sequentialTermination << " when solved in sequence and "
+                  << (int)pipelinedTermination << " when pipelined.\n";
+        passed = false;
+    }
+
+    return passed;
+}
+
 int IpoptTest(int argc, char* argv[])
 {
     int defaultchoice = 1;
@@ -266,6 +324,11 @@ int IpoptTest(int argc, char* argv[])
         passed = IpoptTest2();
         std::cout << "Finished test to solve 2D unconstrained problem using Ipopt." << std::endl;
         break;
+    case 3:
+        std::cout << "Starting test to solve a MINLP problem with pipelined fixed NLP problems:" << std::endl;
+        passed = IpoptTestPipelined("data/tls2.osil");
+        std::cout << "Finished test to solve a MINLP problem with pipelined fixed NLP problems." << std::endl;
+        break;
     default:
         passed = false;
         std::cout << "Test #" << choice << " does not exist!\n";
@@ -11,14 +11,24 @@
 #include "../src/Solver.h"
 #include "../src/Environment.h"
 #include "../src/Settings.h"
+#include "../src/Iteration.h"
+#include "../src/PrimalSolver.h"
+#include "../src/Results.h"
 
 #include "../src/Model/Variables.h"
+#include "../src/Model/AuxiliaryVariables.h"
 #include "../src/Model/Terms.h"
+#include "../src/Model/CompiledExpressions.h"
 #include "../src/Model/Constraints.h"
 #include "../src/Model/NonlinearExpressions.h"
+#include "../src/Model/McCormickRelaxations.h"
 #include "../src/Model/Problem.h"
 
+#include "../src/RootsearchMethod/RootsearchMethodKarySection.h"
+#include "../src/RootsearchMethod/RootsearchMethodNewton.h"
+
 #include "../src/Tasks/TaskReformulateProblem.h"
+#include "../src/Tasks/TaskSelectPrimalCandidatesFromRounding.h"
 
 #include <sstream>
 
@@ -34,6 +44,17 @@ bool ModelTestCreateProblem2();
 bool ModelTestCreateProblem3();
 bool ModelTestConvexity();
 bool ModelTestCopy();
+bool ModelTestAuxiliaryVariableProgram();
+bool ModelTestRootsearchMethods();
+bool ModelTestIncrementalConstraintValues();
+bool ModelTestTermDerivatives();
+bool ModelTestQuadraticObjectiveValue();
+bool ModelTestMcCormickRelaxations();
+bool ModelTestIntervalInfeasibility();
+bool ModelTestCompiledExpressions();
+bool ModelTestRoundingAndRepair();
+bool ModelTestRedundantConstraints();
+bool ModelTestFBBTBoundsCache();
 
 bool TestReadProblem(const std::string& problemFile);
 bool TestRootsearch(const std::string& problemFile);
@@ -89,6 +110,39 @@ int ModelTest(int argc, char* argv[])
     case 10:
         passed = ModelTestCopy();
         break;
+    case 11:
+        passed = ModelTestAuxiliaryVariableProgram();
+        break;
+    case 12:
+        passed = ModelTestRootsearchMethods();
+        break;
+    case 13:
+        passed = ModelTestIncrementalConstraintValues();
+        break;
+    case 14:
+        passed = ModelTestTermDerivatives();
+        break;
+    case 15:
+        passed = ModelTestQuadraticObjectiveValue();
+        break;
+    case 16:
+        passed = ModelTestMcCormickRelaxations();
+        break;
+    case 17:
+        passed = ModelTestIntervalInfeasibility();
+        break;
+    case 18:
+        passed = ModelTestCompiledExpressions();
+        break;
+    case 19:
+        passed = ModelTestRoundingAndRepair();
+        break;
+    case 20:
+        passed = ModelTestRedundantConstraints();
+        break;
+    case 21:
+        passed = ModelTestFBBTBoundsCache();
+        break;
     default:
         passed = false;
         std::cout << "Test #" << choice << " does not exist!\n";
@@ -1187,3 +1241,916 @@ bool ModelTestCopy()
 
     return passed;
 }
+
+bool ModelTestAuxiliaryVariableProgram()
+{
+    bool passed = true;
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, 0.0, 10.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Real, 0.0, 10.0);
+
+    // w2 = 1 + 2*x*y - y
+    auto var_w2 = std::make_shared<SHOT::AuxiliaryVariable>("w2", 2, SHOT::E_VariableType::Real);
+    var_w2->constant = 1.0;
+    var_w2->quadraticTerms.add(std::make_shared<SHOT::QuadraticTerm>(2.0, var_x, var_y));
+    var_w2->linearTerms.add(std::make_shared<SHOT::LinearTerm>(-1.0, var_y));
+
+    // w3 = 3*w2 + 0.5*x^2.5*y + x*y*w2
+    auto var_w3 = std::make_shared<SHOT::AuxiliaryVariable>("w3", 3, SHOT::E_VariableType::Real);
+    var_w3->linearTerms.add(std::make_shared<SHOT::LinearTerm>(3.0, var_w2));
+
+    SHOT::SignomialElements elements;
+    elements.push_back(std::make_shared<SHOT::SignomialElement>(var_x, 2.5));
+    elements.push_back(std::make_shared<SHOT::SignomialElement>(var_y, 1.0));
+    var_w3->signomialTerms.add(std::make_shared<SHOT::SignomialTerm>(0.5, elements));
+
+    SHOT::Variables monomialVariables = { var_x, var_y, var_w2 };
+    var_w3->monomialTerms.add(std::make_shared<SHOT::MonomialTerm>(1.0, monomialVariables));
+
+    // The variables are given in the wrong order, w3 depends on w2
+    SHOT::AuxiliaryVariables auxiliaryVariables = { var_w3, var_w2 };
+
+    SHOT::AuxiliaryVariableProgram program;
+    program.compile(auxiliaryVariables);
+
+    std::vector<SHOT::VectorDouble> points = { { 2.0, 3.0, 0.0, 0.0 }, { 0.5, 1.5, 0.0, 0.0 } };
+
+    for(auto& P : points)
+    {
+        SHOT::VectorDouble point = P;
+        program.execute(point);
+
+        SHOT::VectorDouble realPoint = { P[0], P[1] };
+        realPoint.push_back(var_w2->calculate(realPoint));
+        realPoint.push_back(var_w3->calculate(realPoint));
+
+        std::cout << "Auxiliary variable values: (" << point[2] << ',' << point[3] << ") (should be equal to ("
+                  << realPoint[2] << ',' << realPoint[3] << ")).\n";
+
+        if(std::abs(point[2] - realPoint[2]) > 1e-10 || std::abs(point[3] - realPoint[3]) > 1e-10)
+            passed = false;
+    }
+
+    auto batchPoints = points;
+    program.execute(batchPoints);
+
+    for(size_t i = 0; i < points.size(); i++)
+    {
+        SHOT::VectorDouble point = points[i];
+        program.execute(point);
+
+        std::cout << "Batched auxiliary variable values for point " << i << ": (" << batchPoints[i][2] << ','
+                  << batchPoints[i][3] << ") (should be equal to (" << point[2] << ',' << point[3] << ")).\n";
+
+        if(batchPoints[i] != point)
+            passed = false;
+    }
+
+    return passed;
+}
+
+bool ModelTestRootsearchMethods()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+    SHOT::ProblemPtr problem = std::make_shared<SHOT::Problem>(env);
+    env->problem = problem;
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, -10.0, 10.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Real, -10.0, 10.0);
+
+    SHOT::Variables variables = { var_x, var_y };
+    problem->add(variables);
+
+    auto objectiveFunction
+        = std::make_shared<SHOT::LinearObjectiveFunction>(SHOT::E_ObjectiveFunctionDirection::Minimize);
+    objectiveFunction->add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    problem->add(objectiveFunction);
+
+    // x^2 + y^2 <= 4
+    SHOT::NonlinearExpressions expressions;
+    expressions.add(std::make_shared<SHOT::ExpressionPower>(std::make_shared<SHOT::ExpressionVariable>(var_x),
+        std::make_shared<SHOT::ExpressionConstant>(2.0)));
+    expressions.add(std::make_shared<SHOT::ExpressionPower>(std::make_shared<SHOT::ExpressionVariable>(var_y),
+        std::make_shared<SHOT::ExpressionConstant>(2.0)));
+
+    auto nonlinearConstraint = std::make_shared<SHOT::NonlinearConstraint>(
+        0, "circle", std::make_shared<SHOT::ExpressionSum>(expressions), SHOT::SHOT_DBL_MIN, 4.0);
+    problem->add(nonlinearConstraint);
+
+    problem->finalize();
+
+    std::vector<SHOT::NumericConstraint*> constraints = { nonlinearConstraint.get() };
+
+    std::vector<std::shared_ptr<SHOT::IRootsearchMethod>> rootsearchMethods;
+    rootsearchMethods.push_back(std::make_shared<SHOT::RootsearchMethodNewton>(env));
+    rootsearchMethods.push_back(std::make_shared<SHOT::RootsearchMethodKarySection>(env));
+
+    // The boundary is crossed at (1.2, 1.6) on the segment between (0, 0) and (3, 4)
+    SHOT::VectorDouble interiorPoint = { 0.0, 0.0 };
+    SHOT::VectorDouble exteriorPoint = { 3.0, 4.0 };
+
+    for(auto& R : rootsearchMethods)
+    {
+        auto result = R->findZero(interiorPoint, exteriorPoint, 100, 1e-14, 0.0, constraints, false);
+
+        std::cout << "Root search gave the points (" << result.first[0] << ',' << result.first[1] << ") and ("
+                  << result.second[0] << ',' << result.second[1] << ") (should be close to (1.2,1.6)).\n";
+
+        if(!nonlinearConstraint->isFulfilled(result.first) || nonlinearConstraint->isFulfilled(result.second))
+            passed = false;
+
+        for(auto& P : { result.first, result.second })
+        {
+            if(std::abs(P[0] - 1.2) > 1e-10 || std::abs(P[1] - 1.6) > 1e-10)
+                passed = false;
+        }
+    }
+
+    return passed;
+}
+
+bool ModelTestIncrementalConstraintValues()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+    SHOT::ProblemPtr problem = std::make_shared<SHOT::Problem>(env);
+    env->problem = problem;
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, -10.0, 10.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Binary, 0.0, 1.0);
+    auto var_z = std::make_shared<SHOT::Variable>("z", 2, SHOT::E_VariableType::Binary, 0.0, 1.0);
+
+    SHOT::Variables variables = { var_x, var_y, var_z };
+    problem->add(variables);
+
+    auto objectiveFunction
+        = std::make_shared<SHOT::LinearObjectiveFunction>(SHOT::E_ObjectiveFunctionDirection::Minimize);
+    objectiveFunction->add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    problem->add(objectiveFunction);
+
+    // x + y <= 1
+    auto linearConstraint = std::make_shared<SHOT::LinearConstraint>(0, "linear", SHOT::SHOT_DBL_MIN, 1.0);
+    linearConstraint->add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    linearConstraint->add(std::make_shared<SHOT::LinearTerm>(1.0, var_y));
+    problem->add(linearConstraint);
+
+    // y * z <= 0
+    auto quadraticConstraint = std::make_shared<SHOT::QuadraticConstraint>(1, "quadratic", SHOT::SHOT_DBL_MIN, 0.0);
+    quadraticConstraint->add(std::make_shared<SHOT::QuadraticTerm>(1.0, var_y, var_z));
+    problem->add(quadraticConstraint);
+
+    // x^2 + z <= 2
+    SHOT::NonlinearExpressions expressions;
+    expressions.add(std::make_shared<SHOT::ExpressionPower>(std::make_shared<SHOT::ExpressionVariable>(var_x),
+        std::make_shared<SHOT::ExpressionConstant>(2.0)));
+    expressions.add(std::make_shared<SHOT::ExpressionVariable>(var_z));
+
+    auto nonlinearConstraint = std::make_shared<SHOT::NonlinearConstraint>(
+        2, "nonlinear", std::make_shared<SHOT::ExpressionSum>(expressions), SHOT::SHOT_DBL_MIN, 2.0);
+    problem->add(nonlinearConstraint);
+
+    problem->finalize();
+
+    std::cout << "Variable y is in " << problem->getConstraintsWithVariable(var_y->index).size()
+              << " constraints (should be 2).\n";
+
+    if(problem->getConstraintsWithVariable(var_y->index).size() != 2)
+        passed = false;
+
+    SHOT::VectorDouble basePoint = { 0.5, 0.0, 0.0 };
+    auto constraintValues = problem->getNumericConstraintValues(basePoint);
+
+    // Only the constraints with y are recalculated when changing the value of y
+    SHOT::VectorDouble point = { 0.5, 1.0, 0.0 };
+    problem->updateNumericConstraintValues(point, { var_y->index }, constraintValues);
+
+    auto exactConstraintValues = problem->getNumericConstraintValues(point);
+
+    for(size_t i = 0; i < exactConstraintValues.size(); i++)
+    {
+        std::cout << "Updated value for constraint " << exactConstraintValues[i].constraint->name << ": "
+                  << constraintValues[i].functionValue << " (should be equal to "
+                  << exactConstraintValues[i].functionValue << ").\n";
+
+        if(constraintValues[i].functionValue != exactConstraintValues[i].functionValue
+            || constraintValues[i].isFulfilled != exactConstraintValues[i].isFulfilled)
+            passed = false;
+    }
+
+    return passed;
+}
+
+bool ModelTestTermDerivatives()
+{
+    bool passed = true;
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, 0.0, 10.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Real, 0.0, 10.0);
+    auto var_z = std::make_shared<SHOT::Variable>("z", 2, SHOT::E_VariableType::Real, 0.0, 10.0);
+
+    // 3*x*y*z + 2*x*y
+    SHOT::MonomialTerms monomialTerms;
+    monomialTerms.add(std::make_shared<SHOT::MonomialTerm>(3.0, SHOT::Variables { var_x, var_y, var_z }));
+    monomialTerms.add(std::make_shared<SHOT::MonomialTerm>(2.0, SHOT::Variables { var_x, var_y }));
+
+    // 1.5*x^2.5*y^(-1)*x + 2*y^2*z
+    SHOT::SignomialTerms signomialTerms;
+    signomialTerms.add(std::make_shared<SHOT::SignomialTerm>(1.5,
+        SHOT::SignomialElements { std::make_shared<SHOT::SignomialElement>(var_x, 2.5),
+            std::make_shared<SHOT::SignomialElement>(var_y, -1.0),
+            std::make_shared<SHOT::SignomialElement>(var_x, 1.0) }));
+    signomialTerms.add(std::make_shared<SHOT::SignomialTerm>(2.0,
+        SHOT::SignomialElements { std::make_shared<SHOT::SignomialElement>(var_y, 2.0),
+            std::make_shared<SHOT::SignomialElement>(var_z, 1.0) }));
+
+    // The variable z is zero, so the derivatives cannot be obtained by dividing the value with it
+    SHOT::VectorDouble point = { 1.3, 0.7, 0.0 };
+    SHOT::Variables variables = { var_x, var_y, var_z };
+
+    double stepSize = 1e-5;
+    double tolerance = 1e-4;
+
+    auto checkDerivatives = [&](const std::string& name, const std::function<double(const SHOT::VectorDouble&)>& value,
+                                const std::function<SHOT::SparseVariableVector(const SHOT::VectorDouble&)>& gradient,
+                                const SHOT::SparseVariableMatrix& hessian) {
+        auto exactGradient = gradient(point);
+
+        for(auto& V1 : variables)
+        {
+            auto pointUp = point;
+            auto pointDown = point;
+            pointUp[V1->index] += stepSize;
+            pointDown[V1->index] -= stepSize;
+
+            double approximation = (value(pointUp) - value(pointDown)) / (2 * stepSize);
+            double calculated = exactGradient.count(V1) > 0 ? exactGradient[V1] : 0.0;
+
+            std::cout << name << " gradient w.r.t. " << V1->name << ": " << calculated << " (should be "
+                      << approximation << ").\n";
+
+            if(std::abs(calculated - approximation) > tolerance)
+                passed = false;
+
+            auto gradientUp = gradient(pointUp);
+            auto gradientDown = gradient(pointDown);
+
+            for(auto& V2 : variables)
+            {
+                if(V1->index > V2->index)
+                    continue;
+
+                approximation = ((gradientUp.count(V2) > 0 ? gradientUp[V2] : 0.0)
+                                    - (gradientDown.count(V2) > 0 ? gradientDown[V2] : 0.0))
+                    / (2 * stepSize);
+
+                auto element = hessian.find(std::make_pair(V1, V2));
+                calculated = (element != hessian.end()) ? element->second : 0.0;
+
+                std::cout << name << " Hessian w.r.t. " << V1->name << " and " << V2->name << ": " << calculated
+                          << " (should be " << approximation << ").\n";
+
+                if(std::abs(calculated - approximation) > tolerance)
+                    passed = false;
+            }
+        }
+    };
+
+    checkDerivatives(
+        "Monomial",
+        [&](const SHOT::VectorDouble& P) {
+            double value = 0.0;
+
+            for(auto& T : monomialTerms)
+                value += T->calculate(P);
+
+            return (value);
+        },
+        [&](const SHOT::VectorDouble& P) { return (monomialTerms.calculateGradient(P)); },
+        monomialTerms.calculateHessian(point));
+
+    checkDerivatives(
+        "Signomial",
+        [&](const SHOT::VectorDouble& P) {
+            double value = 0.0;
+
+            for(auto& T : signomialTerms)
+                value += T->calculate(P);
+
+            return (value);
+        },
+        [&](const SHOT::VectorDouble& P) { return (signomialTerms.calculateGradient(P)); },
+        signomialTerms.calculateHessian(point));
+
+    return passed;
+}
+
+bool ModelTestQuadraticObjectiveValue()
+{
+    bool passed = true;
+
+    SHOT::Variables variables;
+
+    for(int i = 0; i < 5; i++)
+    {
+        variables.push_back(std::make_shared<SHOT::Variable>(
+            "x" + std::to_string(i), i, SHOT::E_VariableType::Real, -10.0, 10.0));
+    }
+
+    // The quadratic terms are (sum_i (i+1)*x_i)^2, so the coefficient matrix has rank one
+    SHOT::LinearTerms linearTerms;
+    SHOT::QuadraticTerms quadraticTerms;
+
+    for(int i = 0; i < 5; i++)
+    {
+        linearTerms.add(std::make_shared<SHOT::LinearTerm>(0.5 * i - 1.0, variables[i]));
+
+        for(int j = i; j < 5; j++)
+        {
+            double coefficient = (i == j) ? (i + 1) * (j + 1) : 2.0 * (i + 1) * (j + 1);
+            quadraticTerms.add(std::make_shared<SHOT::QuadraticTerm>(coefficient, variables[i], variables[j]));
+        }
+    }
+
+    auto objective = std::make_shared<SHOT::QuadraticObjectiveFunction>(
+        SHOT::E_ObjectiveFunctionDirection::Minimize, linearTerms, quadraticTerms, 3.0);
+    objective->updateProperties();
+
+    std::vector<SHOT::VectorDouble> points = { { 0.0, 0.0, 0.0, 0.0, 0.0 }, { 1.0, -2.0, 0.5, 3.0, -1.5 },
+        { -7.5, 2.25, 9.0, -0.1, 4.0 } };
+
+    for(auto& P : points)
+    {
+        double objectiveValue = objective->calculateValue(P);
+        double realValue = 3.0 + linearTerms.calculate(P) + quadraticTerms.calculate(P);
+
+        std::cout << "Calculating objective value: " << objectiveValue << " (should be equal to " << realValue
+                  << ").\n";
+
+        if(std::abs(objectiveValue - realValue) > 1e-8 * std::max(1.0, std::abs(realValue)))
+            passed = false;
+    }
+
+    // Changes to the terms should be included in the value
+    objective->add(std::make_shared<SHOT::QuadraticTerm>(-1.0, variables[0], variables[4]));
+    objective->updateProperties();
+
+    double objectiveValue = objective->calculateValue(points[1]);
+    double realValue = 3.0 + linearTerms.calculate(points[1]) + objective->quadraticTerms.calculate(points[1]);
+
+    std::cout << "Calculating objective value: " << objectiveValue << " (should be equal to " << realValue << ").\n";
+
+    if(std::abs(objectiveValue - realValue) > 1e-8 * std::max(1.0, std::abs(realValue)))
+        passed = false;
+
+    // Also when the properties are not updated, and the terms are merged with existing ones so that the number of terms
+    // is unchanged
+    objective->add(std::make_shared<SHOT::LinearTerm>(2.0, variables[1]));
+    objective->quadraticTerms.add(std::make_shared<SHOT::QuadraticTerm>(0.5, variables[2], variables[3]));
+
+    objectiveValue = objective->calculateValue(points[1]);
+    realValue = 3.0 + objective->linearTerms.calculate(points[1]) + objective->quadraticTerms.calculate(points[1]);
+
+    std::cout << "Calculating objective value: " << objectiveValue << " (should be equal to " << realValue << ").\n";
+
+    if(std::abs(objectiveValue - realValue) > 1e-8 * std::max(1.0, std::abs(realValue)))
+        passed = false;
+
+    return passed;
+}
+
+bool ModelTestMcCormickRelaxations()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, -1.0, 2.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Real, 0.5, 3.0);
+    auto expressionVariable_x = std::make_shared<SHOT::ExpressionVariable>(var_x);
+    auto expressionVariable_y = std::make_shared<SHOT::ExpressionVariable>(var_y);
+
+    // 0.5*x + x*y - x^2 + sin(x)*y + exp(x)/y
+    SHOT::LinearTerms linearTerms;
+    linearTerms.add(std::make_shared<SHOT::LinearTerm>(0.5, var_x));
+
+    SHOT::QuadraticTerms quadraticTerms;
+    quadraticTerms.add(std::make_shared<SHOT::QuadraticTerm>(1.0, var_x, var_y));
+    quadraticTerms.add(std::make_shared<SHOT::QuadraticTerm>(-1.0, var_x, var_x));
+
+    auto expression = std::make_shared<SHOT::ExpressionSum>(
+        std::make_shared<SHOT::ExpressionProduct>(
+            std::make_shared<SHOT::ExpressionSin>(expressionVariable_x), expressionVariable_y),
+        std::make_shared<SHOT::ExpressionDivide>(
+            std::make_shared<SHOT::ExpressionExp>(expressionVariable_x), expressionVariable_y));
+
+    auto constraint = std::make_shared<SHOT::NonlinearConstraint>(
+        0, "nlconstr", linearTerms, quadraticTerms, expression, SHOT_DBL_MIN, 1.0);
+
+    SHOT::McCormickRelaxations relaxations(env);
+    SHOT::VectorDouble point = { 0.3, 1.7 };
+
+    // The linearizations of the relaxations should underestimate and overestimate the function within the bounds
+    for(bool isOverestimator : { false, true })
+    {
+        auto linearization = relaxations.calculateLinearization(constraint, point, isOverestimator);
+
+        if(!linearization)
+        {
+            std::cout << "McCormick relaxation could not be calculated.\n";
+            return (false);
+        }
+
+        for(int i = 0; i <= 20; i++)
+        {
+            for(int j = 0; j <= 20; j++)
+            {
+                SHOT::VectorDouble testPoint = { -1.0 + 3.0 * i / 20.0, 0.5 + 2.5 * j / 20.0 };
+
+                double linearizationValue = linearization->second;
+
+                for(auto& [I, C] : linearization->first)
+                    linearizationValue += C * testPoint[I];
+
+                double functionValue = constraint->calculateFunctionValue(testPoint);
+
+                if((!isOverestimator && linearizationValue > functionValue + 1e-8)
+                    || (isOverestimator && linearizationValue < functionValue - 1e-8))
+                {
+                    std::cout << "Linearization of McCormick relaxation has value " << linearizationValue
+                              << " in point (" << testPoint[0] << ", " << testPoint[1]
+                              << "), where the function value is " << functionValue << ".\n";
+                    passed = false;
+                }
+            }
+        }
+    }
+
+    // An unbounded variable in a nonlinear term means that there is no relaxation
+    var_y->upperBound = SHOT_DBL_MAX;
+
+    if(relaxations.calculateLinearization(constraint, point, false))
+    {
+        std::cout << "McCormick relaxation calculated for unbounded variable.\n";
+        passed = false;
+    }
+
+    return passed;
+}
+
+bool ModelTestIntervalInfeasibility()
+{
+    bool passed = true;
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, 0.0, 1.0);
+    auto expressionVariable_x = std::make_shared<SHOT::ExpressionVariable>(var_x);
+
+    // log(x) <= -10
+    auto constraint = std::make_shared<SHOT::NonlinearConstraint>(
+        0, "nlconstr", std::make_shared<SHOT::ExpressionLog>(expressionVariable_x), SHOT_DBL_MIN, -10.0);
+
+    // The logarithm is not defined for all values in [0, 1], so the interval evaluation fails
+    if(constraint->isProvenInfeasible({ SHOT::Interval(0.0, 1.0) }, 1e-8))
+    {
+        std::cout << "Constraint proven infeasible although it cannot be evaluated over the bounds.\n";
+        passed = false;
+    }
+
+    if(!constraint->isProvenInfeasible({ SHOT::Interval(2.0, 3.0) }, 1e-8))
+    {
+        std::cout << "Constraint not proven infeasible for bounds [2, 3].\n";
+        passed = false;
+    }
+
+    if(constraint->isProvenInfeasible({ SHOT::Interval(1e-6, 1.0) }, 1e-8))
+    {
+        std::cout << "Constraint proven infeasible for bounds [1e-6, 1], which contain feasible points.\n";
+        passed = false;
+    }
+
+    return passed;
+}
+
+bool ModelTestCompiledExpressions()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+    SHOT::ProblemPtr problem = std::make_shared<SHOT::Problem>(env);
+    env->problem = problem;
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, -2.0, 2.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Real, 0.5, 3.0);
+    auto var_z = std::make_shared<SHOT::Variable>("z", 2, SHOT::E_VariableType::Real, 0.1, 1.0);
+
+    SHOT::Variables variables = { var_x, var_y, var_z };
+    problem->add(variables);
+
+    auto objectiveFunction
+        = std::make_shared<SHOT::LinearObjectiveFunction>(SHOT::E_ObjectiveFunctionDirection::Minimize);
+    objectiveFunction->add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    problem->add(objectiveFunction);
+
+    auto x = [&]() { return (std::make_shared<SHOT::ExpressionVariable>(var_x)); };
+    auto y = [&]() { return (std::make_shared<SHOT::ExpressionVariable>(var_y)); };
+    auto z = [&]() { return (std::make_shared<SHOT::ExpressionVariable>(var_z)); };
+    auto constant = [](double value) { return (std::make_shared<SHOT::ExpressionConstant>(value)); };
+
+    std::vector<SHOT::NonlinearExpressionPtr> expressions;
+
+    // x^3 + x^(-2) + y^2.5 + y^z, where the integer powers are also evaluated for negative x
+    SHOT::NonlinearExpressions powers;
+    powers.add(std::make_shared<SHOT::ExpressionPower>(x(), constant(3.0)));
+    powers.add(std::make_shared<SHOT::ExpressionPower>(x(), constant(-2.0)));
+    powers.add(std::make_shared<SHOT::ExpressionPower>(y(), constant(2.5)));
+    powers.add(std::make_shared<SHOT::ExpressionPower>(y(), z()));
+    expressions.push_back(std::make_shared<SHOT::ExpressionSum>(powers));
+
+    // x/y + exp(x)/(y*z)
+    expressions.push_back(std::make_shared<SHOT::ExpressionSum>(std::make_shared<SHOT::ExpressionDivide>(x(), y()),
+        std::make_shared<SHOT::ExpressionDivide>(
+            std::make_shared<SHOT::ExpressionExp>(x()), std::make_shared<SHOT::ExpressionProduct>(y(), z()))));
+
+    // log(y)*exp(x) - log(z)
+    expressions.push_back(std::make_shared<SHOT::ExpressionSum>(
+        std::make_shared<SHOT::ExpressionProduct>(
+            std::make_shared<SHOT::ExpressionLog>(y()), std::make_shared<SHOT::ExpressionExp>(x())),
+        std::make_shared<SHOT::ExpressionNegate>(std::make_shared<SHOT::ExpressionLog>(z()))));
+
+    // sin(x)*cos(y) + tan(z) + atan(x*y)
+    expressions.push_back(std::make_shared<SHOT::ExpressionSum>(
+        std::make_shared<SHOT::ExpressionProduct>(
+            std::make_shared<SHOT::ExpressionSin>(x()), std::make_shared<SHOT::ExpressionCos>(y())),
+        std::make_shared<SHOT::ExpressionTan>(z()),
+        std::make_shared<SHOT::ExpressionArcTan>(std::make_shared<SHOT::ExpressionProduct>(x(), y()))));
+
+    std::vector<SHOT::NonlinearConstraintPtr> constraints;
+
+    for(size_t i = 0; i < expressions.size(); i++)
+    {
+        auto constraint = std::make_shared<SHOT::NonlinearConstraint>(
+            i, "nlconstr" + std::to_string(i), expressions[i], SHOT::SHOT_DBL_MIN, 10.0);
+        constraints.push_back(constraint);
+        problem->add(constraint);
+    }
+
+    // Compilation is not enabled in the settings, so the constraints use the ordinary evaluation and CppAD gradients
+    problem->finalize();
+
+    std::vector<std::pair<SHOT::NonlinearExpressionPtr, SHOT::Variables>> expressionsToCompile;
+
+    for(auto& C : constraints)
+        expressionsToCompile.emplace_back(C->nonlinearExpression, C->variablesInNonlinearExpression);
+
+    auto compiledExpressions = SHOT::CompiledExpressions(env).compile(expressionsToCompile);
+
+    if(compiledExpressions.size() != expressionsToCompile.size())
+    {
+        std::cout << "Nonlinear expressions could not be compiled.\n";
+        return (false);
+    }
+
+    std::vector<SHOT::VectorDouble> points = { { -1.5, 0.6, 0.2 }, { -0.4, 1.3, 0.9 }, { 0.7, 2.8, 0.5 },
+        { 1.9, 1.1, 0.1 } };
+
+    auto isClose = [](double first, double second) {
+        return (std::abs(first - second) <= 1e-9 * std::max(1.0, std::abs(second)));
+    };
+
+    for(size_t i = 0; i < constraints.size(); i++)
+    {
+        for(auto& P : points)
+        {
+            double compiledValue = compiledExpressions[i]->calculateValue(P);
+            double value = constraints[i]->nonlinearExpression->calculate(P);
+
+            if(!isClose(compiledValue, value))
+            {
+                std::cout << "Compiled value " << compiledValue << " of constraint " << i << " differs from " << value
+                          << ".\n";
+                passed = false;
+            }
+
+            SHOT::SparseVariableVector compiledGradient;
+            compiledExpressions[i]->calculateGradient(P, compiledGradient);
+            auto gradient = constraints[i]->calculateGradient(P, false);
+
+            for(auto& V : variables)
+            {
+                double compiledElement = (compiledGradient.count(V) > 0) ? compiledGradient[V] : 0.0;
+                double element = (gradient.count(V) > 0) ? gradient[V] : 0.0;
+
+                if(!isClose(compiledElement, element))
+                {
+                    std::cout << "Compiled gradient element " << compiledElement << " for variable " << V->name
+                              << " in constraint " << i << " differs from " << element << ".\n";
+                    passed = false;
+                }
+            }
+        }
+    }
+
+    return passed;
+}
+
+bool ModelTestRoundingAndRepair()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+    SHOT::ProblemPtr problem = std::make_shared<SHOT::Problem>(env);
+    env->problem = problem;
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, 0.0, 10.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Integer, 0.0, 5.0);
+    auto var_b = std::make_shared<SHOT::Variable>("b", 2, SHOT::E_VariableType::Binary, 0.0, 1.0);
+
+    SHOT::Variables variables = { var_x, var_y, var_b };
+    problem->add(variables);
+
+    auto objectiveFunction
+        = std::make_shared<SHOT::LinearObjectiveFunction>(SHOT::E_ObjectiveFunctionDirection::Minimize);
+    objectiveFunction->add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    objectiveFunction->add(std::make_shared<SHOT::LinearTerm>(1.0, var_y));
+    problem->add(objectiveFunction);
+
+    // x + y >= 4
+    auto linearConstraint1 = std::make_shared<SHOT::LinearConstraint>(0, "linear1", 4.0, SHOT::SHOT_DBL_MAX);
+    linearConstraint1->add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    linearConstraint1->add(std::make_shared<SHOT::LinearTerm>(1.0, var_y));
+    problem->add(linearConstraint1);
+
+    // y + b <= 3
+    auto linearConstraint2 = std::make_shared<SHOT::LinearConstraint>(1, "linear2", SHOT::SHOT_DBL_MIN, 3.0);
+    linearConstraint2->add(std::make_shared<SHOT::LinearTerm>(1.0, var_y));
+    linearConstraint2->add(std::make_shared<SHOT::LinearTerm>(1.0, var_b));
+    problem->add(linearConstraint2);
+
+    // x^2 + y <= 7
+    SHOT::NonlinearExpressions expressions;
+    expressions.add(std::make_shared<SHOT::ExpressionPower>(std::make_shared<SHOT::ExpressionVariable>(var_x),
+        std::make_shared<SHOT::ExpressionConstant>(2.0)));
+    expressions.add(std::make_shared<SHOT::ExpressionVariable>(var_y));
+
+    auto nonlinearConstraint = std::make_shared<SHOT::NonlinearConstraint>(
+        2, "nonlinear", std::make_shared<SHOT::ExpressionSum>(expressions), SHOT::SHOT_DBL_MIN, 7.0);
+    problem->add(nonlinearConstraint);
+
+    problem->finalize();
+
+    // The rounded point (2.5, 3, 1) violates the second and third constraints, the repair should decrease y to 2 and
+    // then move x towards sqrt(5)
+    SHOT::SolutionPoint dualSolution;
+    dualSolution.point = { 2.5, 2.6, 0.6 };
+    dualSolution.objectiveValue = 5.1;
+    dualSolution.iterFound = 0;
+
+    env->results->createIteration();
+    env->results->getCurrentIteration()->solutionPoints.push_back(dualSolution);
+
+    auto task = std::make_shared<SHOT::TaskSelectPrimalCandidatesFromRounding>(env);
+    task->run();
+
+    if(env->results->primalSolutions.size() != 1)
+    {
+        std::cout << "Found " << env->results->primalSolutions.size() << " primal solutions (should be 1).\n";
+        return false;
+    }
+
+    auto& primalSolution = env->results->primalSolutions[0];
+    auto& point = primalSolution.point;
+
+    std::cout << "Rounded and repaired point is (" << point[0] << ',' << point[1] << ',' << point[2]
+              << ") (should be close to (2.2361,2,1)).\n";
+
+    if(primalSolution.sourceType != SHOT::E_PrimalSolutionSource::RoundingAndRepair)
+    {
+        std::cout << "Primal solution is not from rounding and repair.\n";
+        passed = false;
+    }
+
+    if(point[1] != 2.0 || point[2] != 1.0)
+    {
+        std::cout << "Discrete variables do not have the expected integer values.\n";
+        passed = false;
+    }
+
+    if(std::abs(point[0] - std::sqrt(5.0)) > 1e-4)
+        passed = false;
+
+    for(auto& C : problem->numericConstraints)
+    {
+        if(C->calculateNumericValue(point).error > 1e-5)
+        {
+            std::cout << "Constraint " << C->name << " is violated in the repaired point.\n";
+            passed = false;
+        }
+    }
+
+    return passed;
+}
+
+bool ModelTestRedundantConstraints()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+    SHOT::ProblemPtr problem = std::make_shared<SHOT::Problem>(env);
+    env->problem = problem;
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, 0.0, 10.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Real, 0.0, 10.0);
+
+    SHOT::Variables variables = { var_x, var_y };
+    problem->add(variables);
+
+    auto objectiveFunction
+        = std::make_shared<SHOT::LinearObjectiveFunction>(SHOT::E_ObjectiveFunctionDirection::Minimize);
+    objectiveFunction->add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    problem->add(objectiveFunction);
+
+    // x + y <= 4
+    auto sumConstraint = std::make_shared<SHOT::LinearConstraint>(0, "sum", SHOT::SHOT_DBL_MIN, 4.0);
+    sumConstraint->add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    sumConstraint->add(std::make_shared<SHOT::LinearTerm>(1.0, var_y));
+    problem->add(sumConstraint);
+
+    // x <= 5, redundant when x <= 4
+    auto boundConstraint = std::make_shared<SHOT::LinearConstraint>(1, "bound", SHOT::SHOT_DBL_MIN, 5.0);
+    boundConstraint->add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    problem->add(boundConstraint);
+
+    // x^2 <= 20, redundant when x <= 4
+    auto squareConstraint = std::make_shared<SHOT::NonlinearConstraint>(2, "square",
+        std::make_shared<SHOT::ExpressionSquare>(std::make_shared<SHOT::ExpressionVariable>(var_x)), SHOT::SHOT_DBL_MIN,
+        20.0);
+    problem->add(squareConstraint);
+
+    // x^2 + y^2 <= 9
+    SHOT::NonlinearExpressions expressions;
+    expressions.add(std::make_shared<SHOT::ExpressionSquare>(std::make_shared<SHOT::ExpressionVariable>(var_x)));
+    expressions.add(std::make_shared<SHOT::ExpressionSquare>(std::make_shared<SHOT::ExpressionVariable>(var_y)));
+
+    auto circleConstraint = std::make_shared<SHOT::NonlinearConstraint>(
+        3, "circle", std::make_shared<SHOT::ExpressionSum>(expressions), SHOT::SHOT_DBL_MIN, 9.0);
+    problem->add(circleConstraint);
+
+    problem->finalize();
+
+    auto isInList = [](const auto& constraints, const auto& constraint) {
+        return (std::find(constraints.begin(), constraints.end(), constraint) != constraints.end());
+    };
+
+    auto printLists = [&]() {
+        std::cout << "Redundant constraints: " << problem->properties.numberOfRedundantConstraints
+                  << ", nonredundant numeric constraints: " << problem->nonredundantNumericConstraints.size()
+                  << ", nonredundant nonlinear constraints: " << problem->nonredundantNonlinearConstraints.size()
+                  << ".\n";
+    };
+
+    printLists();
+
+    if(problem->properties.numberOfRedundantConstraints != 0 || problem->nonredundantNumericConstraints.size() != 4
+        || problem->nonredundantNonlinearConstraints.size() != 2)
+    {
+        std::cout << "Constraints redundant before bound tightening.\n";
+        passed = false;
+    }
+
+    problem->doFBBT();
+
+    std::cout << "Bounds for x after bound tightening: [" << var_x->lowerBound << ',' << var_x->upperBound << "].\n";
+    printLists();
+
+    if(problem->properties.numberOfRedundantConstraints != 2
+        || isInList(problem->nonredundantNumericConstraints, boundConstraint)
+        || isInList(problem->nonredundantNumericConstraints, squareConstraint)
+        || isInList(problem->nonredundantNonlinearConstraints, squareConstraint)
+        || !isInList(problem->nonredundantNumericConstraints, sumConstraint)
+        || !isInList(problem->nonredundantNonlinearConstraints, circleConstraint))
+    {
+        std::cout << "Redundant constraints not removed from the lists after bound tightening.\n";
+        passed = false;
+    }
+
+    // Relaxing a bound may make the constraints violable again
+    problem->setVariableLowerBound(var_x->index, -1.0);
+
+    printLists();
+
+    if(problem->properties.numberOfRedundantConstraints != 0
+        || !isInList(problem->nonredundantNumericConstraints, boundConstraint)
+        || !isInList(problem->nonredundantNumericConstraints, squareConstraint)
+        || !isInList(problem->nonredundantNonlinearConstraints, squareConstraint))
+    {
+        std::cout << "Constraints not restored to the lists after relaxing a bound.\n";
+        passed = false;
+    }
+
+    return passed;
+}
+
+bool ModelTestFBBTBoundsCache()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+
+    // The bounds tightened in one constraint are used in the others, so the cached term bounds must be updated
+    auto createProblem = [&env]() {
+        SHOT::ProblemPtr problem = std::make_shared<SHOT::Problem>(env);
+        env->problem = problem;
+
+        SHOT::Variables variables;
+
+        for(auto name : { "x", "y", "z", "w" })
+        {
+            variables.push_back(std::make_shared<SHOT::Variable>(
+                name, (int)variables.size(), SHOT::E_VariableType::Real, 0.0, 10.0));
+        }
+
+        problem->add(variables);
+
+        auto objectiveFunction
+            = std::make_shared<SHOT::LinearObjectiveFunction>(SHOT::E_ObjectiveFunctionDirection::Minimize);
+        objectiveFunction->add(std::make_shared<SHOT::LinearTerm>(1.0, variables[0]));
+        problem->add(objectiveFunction);
+
+        // x + y + z <= 12
+        auto linearConstraint = std::make_shared<SHOT::LinearConstraint>(0, "linear", SHOT::SHOT_DBL_MIN, 12.0);
+        linearConstraint->add(std::make_shared<SHOT::LinearTerm>(1.0, variables[0]));
+        linearConstraint->add(std::make_shared<SHOT::LinearTerm>(1.0, variables[1]));
+        linearConstraint->add(std::make_shared<SHOT::LinearTerm>(1.0, variables[2]));
+        problem->add(linearConstraint);
+
+        // x^2 + w <= 30
+        auto firstQuadraticConstraint
+            = std::make_shared<SHOT::QuadraticConstraint>(1, "quadratic1", SHOT::SHOT_DBL_MIN, 30.0);
+        firstQuadraticConstraint->add(std::make_shared<SHOT::QuadraticTerm>(1.0, variables[0], variables[0]));
+        firstQuadraticConstraint->add(std::make_shared<SHOT::LinearTerm>(1.0, variables[3]));
+        problem->add(firstQuadraticConstraint);
+
+        // z^2 - w <= 0
+        auto secondQuadraticConstraint
+            = std::make_shared<SHOT::QuadraticConstraint>(2, "quadratic2", SHOT::SHOT_DBL_MIN, 0.0);
+        secondQuadraticConstraint->add(std::make_shared<SHOT::QuadraticTerm>(1.0, variables[2], variables[2]));
+        secondQuadraticConstraint->add(std::make_shared<SHOT::LinearTerm>(-1.0, variables[3]));
+        problem->add(secondQuadraticConstraint);
+
+        problem->finalize();
+
+        return (problem);
+    };
+
+    // The bound tightening is run before and after the lower bound of z is tightened
+    auto cachedProblem = createProblem();
+    cachedProblem->doFBBT();
+    cachedProblem->allVariables[2]->tightenBounds(SHOT::Interval(3.0, 10.0));
+    cachedProblem->doFBBT();
+
+    // The bound tightening is only run after the lower bound of z is tightened
+    auto uncachedProblem = createProblem();
+    uncachedProblem->allVariables[2]->tightenBounds(SHOT::Interval(3.0, 10.0));
+    uncachedProblem->doFBBT();
+
+    // z >= 3 gives w >= 9 in the second quadratic constraint, then x <= sqrt(21) in the first one, and finally y <= 9
+    // in the linear constraint
+    std::vector<SHOT::Interval> expectedBounds = { SHOT::Interval(0.0, std::sqrt(21.0)), SHOT::Interval(0.0, 9.0),
+        SHOT::Interval(3.0, std::sqrt(10.0)), SHOT::Interval(9.0, 10.0) };
+
+    for(size_t i = 0; i < expectedBounds.size(); i++)
+    {
+        auto cachedVariable = cachedProblem->allVariables[i];
+        auto uncachedVariable = uncachedProblem->allVariables[i];
+
+        std::cout << "Bounds for " << cachedVariable->name << ": [" << cachedVariable->lowerBound << ','
+                  << cachedVariable->upperBound << "] and [" << uncachedVariable->lowerBound << ','
+                  << uncachedVariable->upperBound << "] (should be [" << expectedBounds[i].l() << ','
+                  << expectedBounds[i].u() << "]).\n";
+
+        if(std::abs(cachedVariable->lowerBound - uncachedVariable->lowerBound) > 1e-10
+            || std::abs(cachedVariable->upperBound - uncachedVariable->upperBound) > 1e-10)
+        {
+            std::cout << "Bounds differ when the bound tightening is run again.\n";
+            passed = false;
+        }
+
+        if(std::abs(cachedVariable->lowerBound - expectedBounds[i].l()) > 1e-6
+            || std::abs(cachedVariable->upperBound - expectedBounds[i].u()) > 1e-6)
+        {
+            std::cout << "Bounds not tightened as expected.\n";
+            passed = false;
+        }
+    }
+
+    return passed;
+}
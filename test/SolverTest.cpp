@@ -12,6 +12,7 @@
 #include "../src/Environment.h"
 #include "../src/Results.h"
 #include "../src/Structs.h"
+#include "../src/ThreadPool.h"
 #include "../src/TaskHandler.h"
 #include "../src/Utilities.h"
 #include "../src/Model/Simplifications.h"
@@ -29,6 +30,14 @@
 
 #include "../src/Tasks/TaskReformulateProblem.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
 using namespace SHOT;
 
 bool ReadProblem(std::string filename)
@@ -414,6 +423,141 @@ bool CreateAndSolveProblem()
     return passed;
 }
 
+// Runs nested parallel loops and task groups on the pool, and checks that each index is run exactly once and that the
+// exceptions are passed to the caller
+bool RunThreadPoolTasks(ThreadPool& pool)
+{
+    bool passed = true;
+
+    const size_t numberOfOuterElements = 24;
+    const size_t numberOfInnerElements = 24;
+    const size_t numberOfElements = numberOfOuterElements * numberOfInnerElements;
+
+    for(int repetition = 0; repetition < 10; repetition++)
+    {
+        // Parallel loops in parallel loops, task groups in task groups, and parallel loops in task groups
+        std::vector<std::atomic<int>> counts(3 * numberOfElements);
+
+        pool.parallelFor(numberOfOuterElements, [&](size_t i) {
+            pool.parallelFor(numberOfInnerElements, [&](size_t j) { counts[i * numberOfInnerElements + j]++; });
+        });
+
+        TaskGroup group(pool);
+
+        for(size_t i = 0; i < numberOfOuterElements; i++)
+        {
+            group.run([&, i]() {
+                TaskGroup innerGroup(pool);
+
+                for(size_t j = 0; j < numberOfInnerElements; j++)
+                {
+                    innerGroup.run(
+                        [&, i, j]() { counts[numberOfElements + i * numberOfInnerElements + j]++; });
+                }
+
+                pool.parallelFor(numberOfInnerElements,
+                    [&](size_t j) { counts[2 * numberOfElements + i * numberOfInnerElements + j]++; });
+
+                innerGroup.wait();
+            });
+        }
+
+        group.wait();
+
+        if(std::any_of(counts.begin(), counts.end(), [](const auto& C) { return (C != 1); }))
+        {
+            std::cout << "Not all indexes run exactly once in repetition " << repetition << ".\n";
+            passed = false;
+        }
+
+        // An exception in a nested parallel loop is passed through the outer loop
+        try
+        {
+            pool.parallelFor(numberOfOuterElements, [&](size_t i) {
+                pool.parallelFor(numberOfInnerElements, [&](size_t j) {
+                    if(i == 5 && j == 7)
+                        throw std::runtime_error("Exception in parallel loop");
+                });
+            });
+
+            std::cout << "Exception in nested parallel loop not passed to the caller.\n";
+            passed = false;
+        }
+        catch(std::runtime_error& e)
+        {
+            if(std::string(e.what()) != "Exception in parallel loop")
+                passed = false;
+        }
+
+        // An exception in a task is passed to the thread waiting for the group
+        try
+        {
+            TaskGroup exceptionGroup(pool);
+
+            for(size_t i = 0; i < numberOfOuterElements; i++)
+            {
+                exceptionGroup.run([i]() {
+                    if(i == 3)
+                        throw std::runtime_error("Exception in task group");
+                });
+            }
+
+            exceptionGroup.wait();
+
+            std::cout << "Exception in task group not passed to the caller.\n";
+            passed = false;
+        }
+        catch(std::runtime_error& e)
+        {
+            if(std::string(e.what()) != "Exception in task group")
+                passed = false;
+        }
+    }
+
+    return passed;
+}
+
+bool TestThreadPool()
+{
+    bool passed = true;
+
+    // Without any worker threads, and with more threads than there are cores
+    for(int numberOfThreads : { 1, 4 * std::max(2, (int)std::thread::hardware_concurrency()) })
+    {
+        std::cout << "Running tasks on a thread pool with " << numberOfThreads << " threads.\n";
+
+        auto solver = std::make_shared<SHOT::Solver>();
+        solver->updateSetting("MIP.NumberOfThreads", "Dual", numberOfThreads);
+
+        auto result = std::make_shared<std::promise<bool>>();
+        auto finished = result->get_future();
+
+        // The tasks are run in a separate thread, so that a deadlock is detected instead of blocking the test
+        std::thread([solver, result]() {
+            try
+            {
+                result->set_value(RunThreadPoolTasks(*solver->getEnvironment()->threadPool));
+            }
+            catch(...)
+            {
+                std::cout << "Unexpected exception from the thread pool.\n";
+                result->set_value(false);
+            }
+        }).detach();
+
+        if(finished.wait_for(std::chrono::seconds(120)) != std::future_status::ready)
+        {
+            std::cout << "The tasks did not finish, the thread pool seems to be deadlocked.\n";
+            return (false);
+        }
+
+        if(!finished.get())
+            passed = false;
+    }
+
+    return passed;
+}
+
 int SolverTest(int argc, char* argv[])
 {
     int defaultchoice = 1;
@@ -463,6 +607,11 @@ int SolverTest(int argc, char* argv[])
         passed = ReadProblem("data/meanvarxsc.osil");
         std::cout << "Finished test to read OSiL file with semicont. variables." << std::endl;
         break;
+    case 7:
+        std::cout << "Starting test of the thread pool:" << std::endl;
+        passed = TestThreadPool();
+        std::cout << "Finished test of the thread pool." << std::endl;
+        break;
     default:
         passed = false;
         std::cout << "Test #" << choice << " does not exist!\n";